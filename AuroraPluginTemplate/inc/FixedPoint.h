@@ -0,0 +1,132 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FixedPoint.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_FIXEDPOINT_H_
+#define INC_FIXEDPOINT_H_
+
+#include <stdint.h>
+#include "ColorUtils.h"
+
+typedef int32_t q16_t;			/*16 integer and 16 fraction bits, e.g. coordinates and distances*/
+typedef int32_t q15_t;			/*fractions 0 to Q15_ONE, e.g. falloff factors and intensities*/
+
+#define Q16_ONE 65536
+#define Q15_ONE 32768			/*one itself is representable, as a factor at distance 0 is*/
+
+/**
+ * Integer only colour, distance and falloff kernels, for controllers without a floating point unit, where
+ * every float operation is a software call. Each kernel has a Fixed variant, using only integers, and a Float
+ * reference computed in long double with the same interface and rounding. On x86 the long double
+ * reference is exact enough that the two agree bit for bit, so the fixed kernels can be checked on a desktop. The unsuffixed names pick the fixed kernels when plugins are
+ * built with PLUGIN_FIXED_POINT defined, and the references otherwise
+ */
+
+inline q16_t toQ16(double x){
+	return (q16_t)(x * Q16_ONE + ((x < 0) ? -0.5 : 0.5));
+}
+
+inline double fromQ16(q16_t x){
+	return x / (double)Q16_ONE;
+}
+
+/**
+ * @description: floor of the square root of x
+ */
+uint32_t isqrtFixed(uint64_t x);
+uint32_t isqrtFloat(uint64_t x);
+
+/**
+ * @description: distance between two points, rounded down. Coordinates differ by less than 32768
+ */
+q16_t distanceQ16Fixed(q16_t x1, q16_t y1, q16_t x2, q16_t y2);
+q16_t distanceQ16Float(q16_t x1, q16_t y1, q16_t x2, q16_t y2);
+
+/**
+ * @description: 1 / (1 + d * k), rounded to nearest, the falloff of a light source at distance d
+ * @params d, k: not negative
+ */
+q15_t falloffQ15Fixed(q16_t d, q16_t k);
+q15_t falloffQ15Float(q16_t d, q16_t k);
+
+/**
+ * @description: a * (1 - t) + b * t, rounded down, e.g. R = R * (1.0 - factor) + sources[i].R * factor
+ */
+int blendQ15Fixed(int a, int b, q15_t t);
+int blendQ15Float(int a, int b, q15_t t);
+
+/**
+ * @description: colour interpolated in the palette as the examples' getRGB does: half white without a palette,
+ * the first colour at or below 0, the last at or above nColors - 1, and blendQ15 between neighbours
+ * @params position: in colours, from 0 to nColors - 1
+ */
+RGB_t getPaletteRGBQ16Fixed(const RGB_t* palette, int nColors, q16_t position);
+RGB_t getPaletteRGBQ16Float(const RGB_t* palette, int nColors, q16_t position);
+
+/**
+ * @description: base 2 logarithm of x, rounded down
+ * @params x: at least 1
+ */
+q16_t log2Q16Fixed(uint32_t x);
+q16_t log2Q16Float(uint32_t x);
+
+/**
+ * @description: log(x) / log(max), clamped to 0 to Q15_ONE, e.g. FrequencyStars' intensity of a bin against
+ * its running maximum, rounded down. The fixed kernel takes a few times as long as log2Q16Fixed
+ */
+q15_t logRatioQ15Fixed(uint32_t x, uint32_t max);
+q15_t logRatioQ15Float(uint32_t x, uint32_t max);
+
+#ifdef PLUGIN_FIXED_POINT
+#define FIXED_POINT_KERNEL(name) name##Fixed
+#else
+#define FIXED_POINT_KERNEL(name) name##Float
+#endif
+
+inline uint32_t isqrt(uint64_t x){
+	return FIXED_POINT_KERNEL(isqrt)(x);
+}
+
+inline q16_t distanceQ16(q16_t x1, q16_t y1, q16_t x2, q16_t y2){
+	return FIXED_POINT_KERNEL(distanceQ16)(x1, y1, x2, y2);
+}
+
+inline q15_t falloffQ15(q16_t d, q16_t k){
+	return FIXED_POINT_KERNEL(falloffQ15)(d, k);
+}
+
+inline int blendQ15(int a, int b, q15_t t){
+	return FIXED_POINT_KERNEL(blendQ15)(a, b, t);
+}
+
+inline RGB_t getPaletteRGBQ16(const RGB_t* palette, int nColors, q16_t position){
+	return FIXED_POINT_KERNEL(getPaletteRGBQ16)(palette, nColors, position);
+}
+
+inline q16_t log2Q16(uint32_t x){
+	return FIXED_POINT_KERNEL(log2Q16)(x);
+}
+
+inline q15_t logRatioQ15(uint32_t x, uint32_t max){
+	return FIXED_POINT_KERNEL(logRatioQ15)(x, max);
+}
+
+#endif /* INC_FIXEDPOINT_H_ */
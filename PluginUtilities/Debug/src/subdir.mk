@@ -0,0 +1,108 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+CPP_SRCS += \
+../src/AutoGain.cpp \
+../src/BeatAnalysis.cpp \
+../src/BeatEngine.cpp \
+../src/BinOnsetDetector.cpp \
+../src/ColorUtils.cpp \
+../src/DataManager.cpp \
+../src/Decimator.cpp \
+../src/FastOnsetDetector.cpp \
+../src/FftFilterbank.cpp \
+../src/FixedPoint.cpp \
+../src/Histogram.cpp \
+../src/LayoutProcessingUtils.cpp \
+../src/OnsetDetector.cpp \
+../src/PluginFeatures.cpp \
+../src/Point.cpp \
+../src/RealFft.cpp \
+../src/Shapes.cpp \
+../src/SoundFeatureEngine.cpp \
+../src/SoundUtils.cpp \
+../src/SpectralDescriptors.cpp \
+../src/SpectrumRebinner.cpp \
+../src/TempoDetector.cpp 
+
+OBJS += \
+./src/AutoGain.o \
+./src/BeatAnalysis.o \
+./src/BeatEngine.o \
+./src/BinOnsetDetector.o \
+./src/ColorUtils.o \
+./src/DataManager.o \
+./src/Decimator.o \
+./src/FastOnsetDetector.o \
+./src/FftFilterbank.o \
+./src/FixedPoint.o \
+./src/Histogram.o \
+./src/LayoutProcessingUtils.o \
+./src/OnsetDetector.o \
+./src/PluginFeatures.o \
+./src/Point.o \
+./src/RealFft.o \
+./src/Shapes.o \
+./src/SoundFeatureEngine.o \
+./src/SoundUtils.o \
+./src/SpectralDescriptors.o \
+./src/SpectrumRebinner.o \
+./src/TempoDetector.o 
+
+CPP_DEPS += \
+./src/AutoGain.d \
+./src/BeatAnalysis.d \
+./src/BeatEngine.d \
+./src/BinOnsetDetector.d \
+./src/ColorUtils.d \
+./src/DataManager.d \
+./src/Decimator.d \
+./src/FastOnsetDetector.d \
+./src/FftFilterbank.d \
+./src/FixedPoint.d \
+./src/Histogram.d \
+./src/LayoutProcessingUtils.d \
+./src/OnsetDetector.d \
+./src/PluginFeatures.d \
+./src/Point.d \
+./src/RealFft.d \
+./src/Shapes.d \
+./src/SoundFeatureEngine.d \
+./src/SoundUtils.d \
+./src/SpectralDescriptors.d \
+./src/SpectrumRebinner.d \
+./src/TempoDetector.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+src/BinOnsetDetector.o: ../src/BinOnsetDetector.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -O3 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+src/ColorUtils.o: ../src/ColorUtils.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -O3 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+src/SpectralDescriptors.o: ../src/SpectralDescriptors.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -O3 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+src/%.o: ../src/%.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -O0 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+
@@ -0,0 +1,61 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * AutoGain.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_AUTOGAIN_H_
+#define INC_AUTOGAIN_H_
+
+#define AUTO_GAIN_MAX 64.0f				/*keeps silence from being raised to the target*/
+#define AUTO_GAIN_MIN (1.0f / 64)
+
+/**
+ * Automatic gain control of one or more levels. Each channel follows its level with an envelope that rises
+ * with the attack time and falls with the release time, and its gain brings the envelope to the target.
+ * The envelopes start at the target, so the gain starts at 1
+ */
+class AutoGain {
+	AutoGain(const AutoGain&) = delete;
+	int nChannels;
+	float target;
+	float attack;			/*share of the distance to the level the envelope covers per tick when rising*/
+	float release;			/*the same when falling*/
+	float* envelope;
+	float* gain;
+public:
+	AutoGain();
+	~AutoGain();
+
+	/**
+	 * @params attackMs, releaseMs: time for the envelope to cover 63% of a step in the level
+	 * @params tickMs: interval between two calls of autoGainTrack
+	 */
+	void autoGainInit(int nChannels, float target, float attackMs, float releaseMs, float tickMs);
+	void autoGainReset(void);
+
+	/**
+	 * @description: advance the envelopes by one tick
+	 * @params levels: one level per channel
+	 */
+	void autoGainTrack(const float* levels);
+	float getGain(int channel);
+};
+
+#endif /* INC_AUTOGAIN_H_ */
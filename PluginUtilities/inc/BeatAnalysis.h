@@ -0,0 +1,60 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * BeatAnalysis.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_BEATANALYSIS_H_
+#define INC_BEATANALYSIS_H_
+
+#include <stdint.h>
+#include "PluginUtilities.h"
+
+#define BEAT_ANALYSIS_SEGMENT_TICKS 1200	/*60s of features analysed by one thread at a time*/
+#define BEAT_ANALYSIS_WARMUP_TICKS 400		/*20s before a segment replayed to settle the beat engine, about 8 time constants of its tempo estimate*/
+
+/**
+ * The input of a batch beat analysis: either features, one update per tick, or PCM from which the
+ * features are computed as by the sound feature engine. The beat engine is fed PCM as it is live:
+ * the full resolution spectrum, rebinned to the plugin's bins as the library rebins it
+ */
+struct BeatAnalysisSource_t {
+	const uint16_t* energies;
+	const uint8_t* fftBins;		/*nFftBins per tick*/
+	int nFftBins;				/*of the features, or the plugin's bins for PCM*/
+	int fftScale;				/*of the plugin's bins, for PCM*/
+	const float* samples;		/*if not NULL, used instead of the features*/
+	long nSamples;
+	int sampleRate;
+	int nTicks;
+};
+
+/**
+ * @description: run a fresh beat engine over the ticks [first, last) of the source, starting up to
+ * BEAT_ANALYSIS_WARMUP_TICKS early, and store the beat features of [first, last)
+ */
+void analyseBeatSegment(const BeatAnalysisSource_t* source, int first, int last, BeatFeatures_t* beats);
+
+/**
+ * @description: split the source into segments of BEAT_ANALYSIS_SEGMENT_TICKS and analyse them on nThreads threads
+ * @params nThreads: 0 or less to use every core
+ */
+void analyseBeatSegments(const BeatAnalysisSource_t* source, BeatFeatures_t* beats, int nThreads);
+
+#endif /* INC_BEATANALYSIS_H_ */
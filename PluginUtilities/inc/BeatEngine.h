@@ -0,0 +1,59 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * BeatEngine.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_BEATENGINE_H_
+#define INC_BEATENGINE_H_
+
+#include <stdint.h>
+#include "OnsetDetector.h"
+#include "TempoDetector.h"
+
+#define BEAT_SNAP_TICKS 2		/*an onset this close to a predicted beat re-aligns the beat to the onset*/
+#define BEAT_SILENCE_INTERVALS 2	/*stop predicting beats after this many beat intervals without an onset*/
+
+/**
+ * Combines onset detection and tempo estimation into a beat tracker that is ticked once per feature update
+ */
+class BeatEngine {
+	BeatEngine(const BeatEngine&) = delete;
+	OnsetDetector* onsetDetector;
+	TempoDetector* tempoDetector;
+	int ticksSinceBeat;
+	int ticksSinceOnset;
+	bool beat;
+	void updateBeat();
+public:
+	BeatEngine();
+	~BeatEngine();
+	void beatEngineInit(int nFftBins);
+	void beatEngineTick(uint16_t energy, uint8_t* fftBins);
+	bool isBeat();
+	bool isOnset();
+	float getTempo();
+	float getTempoConfidence();
+	float getConfidence();
+	float getNovelty();
+	float getLowFrequencyNovelty();
+	float getOnsetNovelty();
+};
+
+#endif /* INC_BEATENGINE_H_ */
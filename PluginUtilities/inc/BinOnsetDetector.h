@@ -0,0 +1,62 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * BinOnsetDetector.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_BINONSETDETECTOR_H_
+#define INC_BINONSETDETECTOR_H_
+
+#include <stdint.h>
+
+#define BIN_ONSET_TRIGGER_RATIO 0.7f	/*a bin triggers when it rises this share of its running peak above its minimum*/
+#define BIN_ONSET_PEAK_DROP 0.25f		/*a local peak counts once the level has dropped this share of the running peak below it*/
+#define BIN_ONSET_PEAK_TRAIL 4.0f		/*number of peaks the running peak effectively averages; half for rising peaks*/
+#define BIN_ONSET_MINIMUM_DECAY 1.0f	/*per tick, lets a bin retrigger after a long quiet level*/
+#define BIN_ONSET_MIN_RISE 1.0f			/*one step of the 8 bit bins, keeps leakage into quiet bins from triggering*/
+#define BIN_ONSET_INITIAL_PEAK 3.0f		/*running peak of a bin before its first local peak, as FrequencyStars seeds it*/
+
+/**
+ * Per bin onset detection, the algorithm of the FrequencyStars example run on every fft bin.
+ * A bin triggers when it rises far enough above its recent minimum, relative to a running average of
+ * its local peaks. The state is kept as one array per quantity, the onsets included, and updated
+ * without branches, so that the update of all bins vectorizes
+ */
+class BinOnsetDetector {
+	BinOnsetDetector(const BinOnsetDetector&) = delete;
+	int nBins;
+	float* runningPeak;
+	float* minimum;
+	float* previous;
+	float* secondPrevious;
+	float* onset;				/*1 if the bin triggered on the last tick, else 0*/
+	uint32_t* mask;
+public:
+	BinOnsetDetector();
+	~BinOnsetDetector();
+	void binOnsetDetectorInit(int nBins);
+	void binOnsetDetectorTick(const float* bins);
+
+	/**
+	 * @description: bit i % 32 of word i / 32 is set if bin i triggered on the last tick
+	 */
+	const uint32_t* getMask();
+};
+
+#endif /* INC_BINONSETDETECTOR_H_ */
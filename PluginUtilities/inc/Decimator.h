@@ -0,0 +1,54 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * Decimator.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_DECIMATOR_H_
+#define INC_DECIMATOR_H_
+
+#define DECIMATOR_TAPS_PER_FACTOR 16	/*low pass length per unit of decimation factor*/
+#define DECIMATOR_PASSBAND 0.9f			/*cutoff, as a fraction of the output Nyquist frequency*/
+
+/**
+ * Streaming low pass and downsample by an integer factor. Samples can be pushed in blocks of any
+ * length; the filter state carries over between blocks and only every factor-th output is computed
+ */
+class Decimator {
+	Decimator(const Decimator&) = delete;
+	int factor;
+	int nTaps;
+	float* taps;
+	float* history;			/*last nTaps inputs, stored twice so that they can be read without wrapping*/
+	int historyIndex;
+	int phase;				/*inputs since the last output*/
+public:
+	Decimator();
+	~Decimator();
+	void decimatorInit(int factor);
+
+	/**
+	 * @description: filter and downsample a block of samples
+	 * @params out: room for nIn / factor + 1 samples
+	 * @return: number of samples written to out
+	 */
+	int decimatorProcess(const float* in, int nIn, float* out);
+};
+
+#endif /* INC_DECIMATOR_H_ */
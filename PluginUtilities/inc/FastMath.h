@@ -0,0 +1,136 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FastMath.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_FASTMATH_H_
+#define INC_FASTMATH_H_
+
+#include <stdint.h>
+#include <string.h>
+
+#define FAST_RSQRT_MAX_ERROR 5e-6f			/*relative, of fastRsqrt, fastSqrt and fastDistance*/
+#define FAST_LOG2_MAX_ERROR 2.1e-5f			/*absolute, of fastLog2; fastLog is within FAST_LOG2_MAX_ERROR * ln 2*/
+#define FAST_FALLOFF_MAX_ERROR 7e-6f		/*relative, of fastFalloff*/
+
+/**
+ * Approximations of the math in plugins' render loops: the square root in the distance from every source to
+ * every panel, the logarithms of FrequencyStars' intensity and the 1 / (k * d + 1) falloff of a source.
+ * They avoid libm calls and divisions, and stay within the errors above for finite, normal arguments in their
+ * domain. Each has a batch form over arrays, written without branches or calls so that the compiler
+ * vectorizes it when optimizing (-O3). The host's -m option benchmarks them against libm
+ */
+
+inline uint32_t floatBits(float x){
+	uint32_t i;
+	memcpy(&i, &x, sizeof(i));
+	return i;
+}
+
+inline float bitsFloat(uint32_t i){
+	float x;
+	memcpy(&x, &i, sizeof(x));
+	return x;
+}
+
+/**
+ * @description: 1 / sqrt(x), from an estimate halving the exponent, refined by two Newton steps
+ * @params x: greater than 0
+ */
+inline float fastRsqrt(float x){
+	float r = bitsFloat(0x5F375A86 - (floatBits(x) >> 1));
+	r = r * (1.5f - 0.5f * x * r * r);
+	return r * (1.5f - 0.5f * x * r * r);
+}
+
+/**
+ * @params x: 0 or more
+ */
+inline float fastSqrt(float x){
+	return x * fastRsqrt(x);
+}
+
+inline float fastDistance(float x1, float y1, float x2, float y2){
+	float dx = x2 - x1;
+	float dy = y2 - y1;
+	return fastSqrt(dx * dx + dy * dy);
+}
+
+/**
+ * @description: base 2 logarithm: the exponent, plus a degree 5 polynomial in the mantissa
+ * @params x: greater than 0
+ */
+inline float fastLog2(float x){
+	uint32_t i = floatBits(x);
+	float e = (float)((int)(i >> 23) - 127);
+	float m = bitsFloat((i & 0x007FFFFF) | 0x3F800000) - 1.0f;
+	float p = 0.043004958f;
+	p = p * m - 0.18748860f;
+	p = p * m + 0.40947030f;
+	p = p * m - 0.70648645f;
+	p = p * m + 1.4414924f;
+	p = p * m + 1.6514671e-5f;
+	return e + p;
+}
+
+inline float fastLog(float x){
+	return fastLog2(x) * 0.69314718f;
+}
+
+/**
+ * @description: 1 / (k * d + 1), from an estimate negating the exponent, refined by two Newton steps. Vectorized
+ * division is as fast on x86; this pays where division is slow or, as on the controller, emulated
+ * @params d, k: 0 or more, with k * d below 1e37
+ */
+inline float fastFalloff(float d, float k){
+	float y = k * d + 1.0f;
+	float r = bitsFloat(0x7EF311C3 - floatBits(y));
+	r = r * (2.0f - y * r);
+	return r * (2.0f - y * r);
+}
+
+inline void fastRsqrtBatch(const float* x, float* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = fastRsqrt(x[i]);
+	}
+}
+
+/**
+ * @description: out[i] is the distance from (x, y) to (px[i], py[i]), e.g. from a source to every panel
+ */
+inline void fastDistanceBatch(float x, float y, const float* px, const float* py, float* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = fastDistance(x, y, px[i], py[i]);
+	}
+}
+
+inline void fastLog2Batch(const float* x, float* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = fastLog2(x[i]);
+	}
+}
+
+inline void fastFalloffBatch(const float* d, float k, float* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = fastFalloff(d[i], k);
+	}
+}
+
+#endif /* INC_FASTMATH_H_ */
@@ -0,0 +1,53 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FastOnsetDetector.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_FASTONSETDETECTOR_H_
+#define INC_FASTONSETDETECTOR_H_
+
+#define FAST_ONSET_THRESHOLD_RATIO 3.0f		/*energy must exceed this multiple of its recent average*/
+#define FAST_ONSET_AVERAGE_MS 250.0f		/*time constant of the recent average*/
+#define FAST_ONSET_MIN_ENERGY 64.0f			/*energy floor, keeps silence from triggering onsets*/
+#define FAST_ONSET_REFRACTORY_MS 100.0f		/*minimum time between two onsets*/
+
+/**
+ * Detects onsets in the time domain from the energy of short hops, a few ms each. An onset is a hop
+ * much louder than the recent average, so drum hits are found without waiting for a full fft frame
+ */
+class FastOnsetDetector {
+	FastOnsetDetector(const FastOnsetDetector&) = delete;
+	float hopMs;
+	float rate;				/*share of the distance to each hop's energy the average covers*/
+	float average;
+	float msSinceOnset;
+	bool onset;
+public:
+	FastOnsetDetector();
+	void fastOnsetDetectorInit(float hopMs);
+
+	/**
+	 * @params energy: of one hop, in the units of getEnergy
+	 */
+	void fastOnsetDetectorTick(float energy);
+	bool isOnset();
+};
+
+#endif /* INC_FASTONSETDETECTOR_H_ */
@@ -0,0 +1,65 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FftFilterbank.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_FFTFILTERBANK_H_
+#define INC_FFTFILTERBANK_H_
+
+#include <vector>
+
+#define FFT_FILTERBANK_MIN_HZ 40.0f		/*lowest band edge of log and mel spaced bins*/
+
+/**
+ * Rebins a power spectrum into nOut bins with the spacing given by one of the FFT_SCALE_ values.
+ * Linear bins average equal chunks, as music_processor.py. Log and mel bins are triangular filters
+ * on log or mel spaced centres, normalized to unit sum so that every scale keeps the level of the spectrum.
+ * The weights are sparse and computed once, so applying costs one short dot product per output bin
+ */
+class FftFilterbank {
+	FftFilterbank(const FftFilterbank&) = delete;
+	int nOut;
+	int* start;			/*first input bin of each output bin*/
+	int* offset;		/*index of its first weight, offset[nOut] is the number of weights*/
+	float* weights;
+	void buildLinear(int nIn);
+	void buildTriangular(int nIn, int scale, float hzPerBin);
+	void buildRectangular(int nIn, const float* edges, float hzPerBin);
+	void setWeights(const std::vector<float>& sparse);
+public:
+	FftFilterbank();
+	~FftFilterbank();
+
+	/**
+	 * @params nIn: number of spectrum bins, bin k centred on k * hzPerBin
+	 * @params hzPerBin: only used by the mel scale
+	 */
+	void fftFilterbankInit(int nIn, int nOut, int scale, float hzPerBin);
+
+	/**
+	 * @description: rectangular bands instead, each averaging the bins it covers. Bin k spans half a bin
+	 * either side of its centre, and bins cut by a band edge are weighted by the part inside the band
+	 * @params edges: nOut + 1 ascending band edges in Hz
+	 */
+	void fftFilterbankInitBands(int nIn, int nOut, const float* edges, float hzPerBin);
+	void fftFilterbankApply(const float* in, float* out);
+};
+
+#endif /* INC_FFTFILTERBANK_H_ */
@@ -0,0 +1,128 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * Fifo.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_FIFO_H_
+#define INC_FIFO_H_
+
+/**
+ * A fixed capacity first-in-first-out buffer. Pushing into a full Fifo drops the oldest element.
+ * Index 0 is the oldest element, getLength() - 1 the newest.
+ */
+template <typename T>
+class Fifo {
+	Fifo(const Fifo&) = delete;
+	T* buffer;
+	int capacity;
+	int head;		/*index of the oldest element*/
+	int length;
+public:
+	Fifo(int capacity);
+	~Fifo();
+	void push(T value);
+	T pop();
+	T getHead();
+	T getElementAtIndex(int index);
+	int getLength();
+	bool isEmpty();
+	bool isMember(T value);
+	float getAverage();
+};
+
+template <typename T>
+Fifo<T>::Fifo(int _capacity){
+	capacity = _capacity;
+	buffer = new T[capacity];
+	head = 0;
+	length = 0;
+}
+
+template <typename T>
+Fifo<T>::~Fifo(){
+	delete [] buffer;
+}
+
+template <typename T>
+void Fifo<T>::push(T value){
+	if (length == capacity){
+		buffer[head] = value;
+		head = (head + 1) % capacity;
+	}
+	else {
+		buffer[(head + length) % capacity] = value;
+		length++;
+	}
+}
+
+template <typename T>
+T Fifo<T>::pop(){
+	T value = buffer[head];
+	head = (head + 1) % capacity;
+	length--;
+	return value;
+}
+
+/**
+ * @return: the newest element
+ */
+template <typename T>
+T Fifo<T>::getHead(){
+	return buffer[(head + length - 1) % capacity];
+}
+
+template <typename T>
+T Fifo<T>::getElementAtIndex(int index){
+	return buffer[(head + index) % capacity];
+}
+
+template <typename T>
+int Fifo<T>::getLength(){
+	return length;
+}
+
+template <typename T>
+bool Fifo<T>::isEmpty(){
+	return length == 0;
+}
+
+template <typename T>
+bool Fifo<T>::isMember(T value){
+	for (int i = 0; i < length; i++){
+		if (getElementAtIndex(i) == value){
+			return true;
+		}
+	}
+	return false;
+}
+
+template <typename T>
+float Fifo<T>::getAverage(){
+	if (length == 0){
+		return 0;
+	}
+	float sum = 0;
+	for (int i = 0; i < length; i++){
+		sum += getElementAtIndex(i);
+	}
+	return sum / length;
+}
+
+#endif /* INC_FIFO_H_ */
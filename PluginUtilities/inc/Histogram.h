@@ -0,0 +1,65 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * Histogram.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_HISTOGRAM_H_
+#define INC_HISTOGRAM_H_
+
+#define HISTOGRAM_DEFAULT_LENGTH 32
+#define HISTOGRAM_DEGRADE_FACTOR 0.98f		/*every bin is multiplied by this on each degradeHistogram*/
+#define HISTOGRAM_MIN_SCALE 1e-20f			/*the bins are rescaled before the scale factor underflows*/
+
+/**
+ * Degrading is lazy: the bins are stored divided by a common scale factor, so that degrading only
+ * scales that factor, and the total is kept up to date as bins are added to
+ */
+class Histogram {
+	Histogram(const Histogram&) = delete;
+	float* bins;
+	int length;
+	float scale;
+	float total;			/*sum of the stored bins*/
+public:
+	Histogram();
+	Histogram(int length);
+	~Histogram();
+
+	void incrementHistogramBin(int bin);
+	void addToHistogramBin(int bin, float value);
+	float getHistogramBin(int bin);
+	int getLength();
+
+	/**
+	 * @description: let old observations fade away by scaling down every bin
+	 */
+	void degradeHistogram();
+
+	/**
+	 * @description: the fraction of the histogram's total weight that falls into the given bins
+	 * @params bins: the bins to add up
+	 * @params nBins: number of bins in bins
+	 */
+	float getProbabilityOfBins(int* bins, int nBins);
+
+	void displayHistogram(int width);
+};
+
+#endif /* INC_HISTOGRAM_H_ */
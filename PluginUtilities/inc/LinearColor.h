@@ -0,0 +1,97 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * LinearColor.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_LINEARCOLOR_H_
+#define INC_LINEARCOLOR_H_
+
+#include <stdint.h>
+#include "RGB8.h"
+
+#define LINEAR_ONE 65535				/*full scale of linear light, and of the blend weights*/
+#define GAMMA_ENCODE_BITS 12			/*linear light is encoded through a table indexed by its top bits*/
+
+/**
+ * Colours in linear light, 16 bit fixed point. Blending sRGB values directly, as R * (1 - f) + R2 * f,
+ * darkens and muddies the colours in between and steps visibly in fades, as sRGB is far from linear in the light
+ * given off. Decode colours with toLinear, blend, and encode with fromLinear: each costs one table lookup per
+ * component. The tables are filled by the utilities library when it is loaded
+ */
+struct LinearRGB_t {
+	uint16_t R, G, B;
+};
+
+extern uint16_t gammaDecodeTable[256];						/*sRGB component to linear light*/
+extern uint8_t gammaEncodeTable[1 << GAMMA_ENCODE_BITS];	/*top GAMMA_ENCODE_BITS of linear light to sRGB*/
+
+inline LinearRGB_t toLinear(const RGB8_t& c){
+	return (LinearRGB_t){gammaDecodeTable[c.R], gammaDecodeTable[c.G], gammaDecodeTable[c.B]};
+}
+
+inline RGB8_t fromLinear(const LinearRGB_t& c){
+	return (RGB8_t){gammaEncodeTable[c.R >> (16 - GAMMA_ENCODE_BITS)], gammaEncodeTable[c.G >> (16 - GAMMA_ENCODE_BITS)],
+			gammaEncodeTable[c.B >> (16 - GAMMA_ENCODE_BITS)], 0};
+}
+
+/**
+ * @description: a * (LINEAR_ONE - t) / LINEAR_ONE + b * t / LINEAR_ONE, rounded
+ */
+inline uint16_t lerpLinearComponent(uint16_t a, uint16_t b, uint16_t t){
+	return (uint16_t)(((uint32_t)a * (LINEAR_ONE - t) + (uint32_t)b * t + LINEAR_ONE / 2) / LINEAR_ONE);
+}
+
+/**
+ * @description: from blended towards to by t / LINEAR_ONE, e.g. t = factor * LINEAR_ONE for a float factor
+ */
+inline LinearRGB_t lerpLinear(const LinearRGB_t& from, const LinearRGB_t& to, uint16_t t){
+	return (LinearRGB_t){lerpLinearComponent(from.R, to.R, t), lerpLinearComponent(from.G, to.G, t),
+			lerpLinearComponent(from.B, to.B, t)};
+}
+
+/**
+ * saturating add, e.g. to sum the light of several sources on a panel
+ */
+inline LinearRGB_t addLinear(const LinearRGB_t& l, const LinearRGB_t& r){
+	uint32_t R = (uint32_t)l.R + r.R;
+	uint32_t G = (uint32_t)l.G + r.G;
+	uint32_t B = (uint32_t)l.B + r.B;
+	return (LinearRGB_t){(uint16_t)((R > LINEAR_ONE) ? LINEAR_ONE : R), (uint16_t)((G > LINEAR_ONE) ? LINEAR_ONE : G),
+			(uint16_t)((B > LINEAR_ONE) ? LINEAR_ONE : B)};
+}
+
+/**
+ * @description: c * s / LINEAR_ONE, e.g. to dim a colour by its intensity
+ */
+inline LinearRGB_t scaleLinear(const LinearRGB_t& c, uint16_t s){
+	return lerpLinear((LinearRGB_t){0, 0, 0}, c, s);
+}
+
+/**
+ * @description: out[i] = from[i] blended towards to[i] by t / LINEAR_ONE in linear light, e.g. to cross fade
+ * two frames. out may be from or to
+ */
+inline void lerpLinearRGB8Array(const RGB8_t* from, const RGB8_t* to, uint16_t t, RGB8_t* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = fromLinear(lerpLinear(toLinear(from[i]), toLinear(to[i]), t));
+	}
+}
+
+#endif /* INC_LINEARCOLOR_H_ */
@@ -0,0 +1,67 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * OnsetDetector.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_ONSETDETECTOR_H_
+#define INC_ONSETDETECTOR_H_
+
+#include <stdint.h>
+#include "Fifo.h"
+
+#define ONSET_HISTORY_LENGTH 16			/*ticks of novelty used for the adaptive threshold*/
+#define ONSET_THRESHOLD_RATIO 1.6f		/*novelty must exceed this multiple of the recent average*/
+#define ONSET_MIN_NOVELTY 4.0f			/*novelty floor, keeps silence from triggering onsets*/
+#define ONSET_REFRACTORY_TICKS 2		/*minimum number of ticks between two onsets*/
+
+/**
+ * Detects onsets from the positive spectral flux of the fft bins and the rise of the energy
+ */
+class OnsetDetector {
+	OnsetDetector(const OnsetDetector&) = delete;
+	uint8_t* previousFft;
+	int nFftBins;
+	uint16_t previousEnergy;
+	float novelty;
+	float lowFrequencyNovelty;
+	float onsetNovelty;			/*novelty of the most recent onset*/
+	bool onset;
+	int ticksSinceOnset;
+	Fifo<float>* noveltyHistory;
+	void updateNovelty(uint16_t energy, uint8_t* fftBins);
+	void onsetDetect();
+public:
+	OnsetDetector();
+	~OnsetDetector();
+	void onsetDetectorInit(int nFftBins);
+	void onsetDetectorTick(uint16_t energy, uint8_t* fftBins);
+	bool isOnset();
+	float getNovelty();
+	float getLowFrequencyNovelty();
+	float getOnsetNovelty();
+	void onsetDetectorPrint(int width);
+};
+
+/**
+ * @description: sum of the positive differences between fftBins and previousFft over the bins [lo, hi)
+ */
+float accumulateFrequencyNovelty(uint8_t* fftBins, uint8_t* previousFft, int lo, int hi);
+
+#endif /* INC_ONSETDETECTOR_H_ */
@@ -0,0 +1,102 @@
+/*
+ * AdvancedFeatures.h
+ *
+ *  Created on: Jul 5, 2017
+ *      Author: leizhang
+ */
+
+#ifndef INC_PLUGINFEATURES_H_
+#define INC_PLUGINFEATURES_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ----------------------------------
+ * RHYTHM FEATURE FUNCTIONS
+ * ----------------------------------
+ */
+#define FFT_SCALE_LINEAR 0		// equal width bins, as enableFft
+#define FFT_SCALE_LOG 1			// logarithmically spaced bins, the same number of bins per octave
+#define FFT_SCALE_MEL 2			// mel spaced bins, wide at the top like log, closer to linear in the bass
+#define MAX_ENERGY_BANDS 32
+#define MAX_FFT_BINS 256		// largest bin count a plugin may request through enableFft
+#define AUTO_GAIN_ENERGY_TARGET 16384	// level getEnergy settles at under enableAutoGain
+#define AUTO_GAIN_FFT_TARGET 160		// level the loudest fft bin, or every bin if per bin, settles at
+
+void enableEnergy(void);
+void enableFft(uint16_t nFftBins);
+void enableFftScaled(uint16_t nFftBins, uint8_t scale);	// enableFft with bins spaced as one of the FFT_SCALE_ values below
+void enableAutoGain(uint16_t attackMs, uint16_t releaseMs, bool isPerBin);	// hold getEnergy and the fft bins at a steady
+										// level however loud the room; the gain falls within attackMs of the sound getting
+										// louder and recovers within releaseMs, e.g. 100 and 5000. isPerBin gives every bin
+										// its own gain, flattening the spectrum. Band energies and rebinned bins keep their level
+float getAutoGain(void);		// gain currently applied to getEnergy, 1 without enableAutoGain
+void enableDistance(void);
+void enableSpeed(void);			// get motion speed in m/s
+uint16_t getEnergy(void);
+uint8_t *getFftBins(void);
+uint16_t *getFftBins16(void);	// getFftBins without the saturation at 255, in the same units
+float *getFftBinsF(void);		// getFftBins16 before rounding
+const float *getFftBinsRebinned(uint16_t nFftBins);	// the spectrum behind getFftBinsF as nFftBins linear bins, e.g. for a second
+													// zone of panels; cached per update, NULL before enableFft or beyond MAX_FFT_BINS
+uint8_t getDistance(void);
+uint8_t getSpeed(void);
+uint64_t getFeatureTimestamp(void);	// capture time of the current features in microseconds of the monotonic clock
+									// (CLOCK_MONOTONIC, std::chrono::steady_clock), e.g. to time a transition to land on the sound
+uint32_t getFeatureSequence(void);	// sequence number of the current features, a gap means updates were dropped
+void enableBandEnergy(uint8_t nBands, const float* edges);	// edges: nBands + 1 ascending frequencies in Hz, or NULL
+															// for log spaced bands from 40 Hz to the top of the spectrum
+float *getBandEnergies(void);	// mean level of the full resolution spectrum across each band, in the units of getFftBinsF
+uint16_t getDominantBin(void);	// index of the strongest fft bin
+float getSpectralCentroid(void);	// bin index averaged with the bins as weights, higher for brighter sounds
+float getSpectralFlux(void);	// sum of the rises of the fft bins since the previous update, high on onsets
+float getSpectralRolloff(void);	// bin index below which 85% of the sum of the fft bins lies
+float getBeatWindowDominantBin(void);	// getDominantBin averaged over the updates since the previous beat, at a beat
+										// over the beat that just ended. Needs enableBeatFeatures to restart
+float getBeatWindowCentroid(void);	// getSpectralCentroid averaged in the same way
+const uint32_t *getBinOnsetMask(void);	// bit i % 32 of word i / 32 is set if fft bin i rose sharply on this update
+bool getIsBinOnset(uint16_t bin);	// one bit of getBinOnsetMask
+
+/* ----------------------------------
+ * BEAT FEATURE FUNCTIONS
+ * ----------------------------------
+ */
+void enableBeatFeatures(void);	// enable beat features
+bool getIsBeat(void);			// get beat flag
+bool getIsOnset(void);			// get onset flag
+float getTempo(void);			// get tempo in beats-per-minute (bpm)
+float getTempoConfidence(void);	// 0 to 1, how well the tempo fits the recent onsets, kept while beats are not predicted
+float getBeatPhase(void);		// progress from the last beat to the next predicted one, from 0 up to 1
+float getTimeToNextBeat(void);	// in ms from the capture of the current features to the next predicted beat, e.g. to
+								// start a transition of that length, or time it with getFeatureTimestamp
+float getBeatConfidence(void);	// 0 to 1, how far the two above can be trusted; 0 while no beats are predicted
+
+/* ----------------------------------
+ * FEATURE SNAPSHOT
+ * ----------------------------------
+ */
+// The features of one update, rhythm and beat together, as returned by the getters above
+struct FeatureSnapshot_t {
+	uint64_t timestamp;
+	uint32_t sequence;
+	uint16_t energy;
+	uint16_t nFftBins;
+	uint8_t fftBins[MAX_FFT_BINS];
+	bool isBeat;
+	bool isOnset;
+	float tempo;
+	float beatPhase;
+	float timeToNextBeat;
+	float beatConfidence;
+};
+
+// point snapshot to the latest complete update. Without locking, and safe if the features are updated on
+// another thread: the snapshot stays unchanged until the next call. Returns whether it is newer than the last one
+bool getFeatureSnapshot(const struct FeatureSnapshot_t** snapshot);
+
+/* -----------------------------------
+ * MORE ADVANCED FEATURES ...
+ * -----------------------------------
+ */
+
+#endif /* INC_PLUGINFEATURES_H_ */
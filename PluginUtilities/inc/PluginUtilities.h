@@ -0,0 +1,236 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * PluginUtilities.h
+ *
+ *  Created on: Oct 15, 2026
+ *
+ *  Host-side interface of libPluginUtilities. These functions are not meant to be called by plugins;
+ *  they are looked up by the host (SoundModuleHost) through the plugin's handle, which resolves them
+ *  from the copy of libPluginUtilities that the plugin was linked against.
+ */
+
+#ifndef INC_PLUGINUTILITIES_H_
+#define INC_PLUGINUTILITIES_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "PluginFeatures.h"
+
+#define PLUGIN_UTILITIES_VERSION "2.0-linux"
+
+#define FFT_SPECTRUM_BINS 256			/*bins of the full resolution spectrum computed by the feature source*/
+#define FFT_SPECTRUM_HZ_PER_BIN 21.5f	/*width of a spectrum bin at the usual 44.1kHz input, decimated by 4 into a 512 point fft*/
+#define BEAT_ENGINE_FFT_BINS 32			/*bin count requested on behalf of plugins that only enable beat features*/
+#define FEATURE_TICK_MS 50				/*nominal interval between two feature updates*/
+#define LAYOUT_INTS_PER_PANEL 5			/*panelId, x, y, orientation, shapeType*/
+#define PALETTE_INTS_PER_COLOR 3		/*hue [0, 360), saturation [0, 100], brightness [0, 100]*/
+
+/**
+ * Features requested by the plugin during initPlugin
+ */
+struct EnabledFeatures_t {
+	bool energy;
+	bool fft;
+	uint16_t nFftBins;
+	uint8_t fftScale;			/*FFT_SCALE_ value, see PluginFeatures.h*/
+	uint8_t nBands;				/*band energies requested through enableBandEnergy*/
+	bool distance;
+	bool speed;
+	bool beatFeatures;
+	EnabledFeatures_t(){
+		energy = false;
+		fft = false;
+		nFftBins = 0;
+		fftScale = FFT_SCALE_LINEAR;
+		nBands = 0;
+		distance = false;
+		speed = false;
+		beatFeatures = false;
+	}
+};
+
+/**
+ * @description: number of bins the feature source has to send. The source computes the full resolution
+ * spectrum once, whatever the plugin asked for, and the utilities library derives the plugin's bins,
+ * band energies and any other bin counts from it
+ */
+inline uint16_t getSourceFftBins(const EnabledFeatures_t* enabledFeatures){
+	return (enabledFeatures->fft || enabledFeatures->nBands > 0) ? FFT_SPECTRUM_BINS : 0;
+}
+
+/**
+ * One update of the rhythm features, as produced by the sound feature source
+ */
+struct RhythmFeatures_t {
+	uint16_t energy;
+	const uint8_t* fftBins;		/*nFftBins bins, only read during updateRhythmFeatures*/
+	const uint16_t* fftBins16;	/*if not NULL, used instead of fftBins: the same bins without saturation at 255*/
+	const float* fftBinsF;		/*if not NULL, used instead of either: the same bins unrounded*/
+	uint16_t nFftBins;
+	uint8_t distance;
+	uint8_t speed;
+	uint64_t timestamp;			/*capture time in microseconds of the monotonic clock, see getFeatureTimestamp*/
+	uint32_t sequence;
+	RhythmFeatures_t(){
+		energy = 0;
+		fftBins = 0;
+		fftBins16 = 0;
+		fftBinsF = 0;
+		nFftBins = 0;
+		distance = 0;
+		speed = 0;
+		timestamp = 0;
+		sequence = 0;
+	}
+};
+
+/**
+ * The beat features served to the plugin, either computed by the beat engine or passed in by the host
+ */
+struct BeatFeatures_t {
+	bool isBeat;
+	bool isOnset;
+	float tempo;		/*in bpm*/
+	float confidence;	/*0 to 1, how steady the tempo is; 0 while no beats are predicted*/
+	BeatFeatures_t(){
+		isBeat = false;
+		isOnset = false;
+		tempo = 0;
+		confidence = 0;
+	}
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+	/**
+	 * @description: version string of this build of the utilities library
+	 */
+	const char* getPluginUtilitiesVersion(void);
+
+	/**
+	 * @description: hand the panel layout over to the Data Manager
+	 * @params layoutDataByteStream: globalOrientation followed by LAYOUT_INTS_PER_PANEL ints for each panel
+	 * @params nPanels: number of panels in the stream
+	 */
+	void passLayoutData(int* layoutDataByteStream, int nPanels);
+
+	/**
+	 * @description: hand the colour palette over to the Data Manager
+	 * @params colorByteStream: PALETTE_INTS_PER_COLOR ints for each colour
+	 * @params nColors: number of colours in the stream
+	 */
+	void passColorPalette(int* colorByteStream, int nColors);
+
+	/**
+	 * @description: release the layout and the palette
+	 */
+	void dataManagerCleanup(void);
+
+	/**
+	 * @description: the features the plugin enabled. Valid after initPlugin has returned
+	 */
+	const EnabledFeatures_t* getEnabledFeatures(void);
+
+	void initRhythmFeatures(void);
+	/**
+	 * @description: the bins are as sent by the feature source, see getSourceFftBins, and the plugin's bins
+	 * are computed from them here. Bins already at the plugin's linear resolution are taken as they are
+	 */
+	void updateRhythmFeatures(const RhythmFeatures_t* rhythmFeatures);
+	void deinitRhythmFeatures(void);
+
+	/**
+	 * @description: like updateRhythmFeatures, but getFftBins serves the caller's bins in place instead of
+	 * a copy. The bins must be exactly the requested linear nFftBins, must stay valid until the next update
+	 * and may be written to by the plugin; otherwise, or if the bins have to be scaled, they are copied
+	 * as by updateRhythmFeatures
+	 */
+	void passRhythmFeatureView(const RhythmFeatures_t* rhythmFeatures);
+
+	/**
+	 * @description: updateBeatFeatures advances the beat engine by one tick, using the rhythm features
+	 * passed in by the most recent updateRhythmFeatures
+	 */
+	void initBeatFeatures(void);
+	void updateBeatFeatures(void);
+	void deinitBeatFeatures(void);
+
+	/**
+	 * @description: serve the given beat features instead of running the beat engine, e.g. when replaying
+	 * a recorded trace. Needs no initBeatFeatures
+	 */
+	void passBeatFeatures(const BeatFeatures_t* beatFeatures);
+
+	/**
+	 * @description: the beat features currently served to the plugin, e.g. for recording them
+	 */
+	const BeatFeatures_t* getBeatFeatures(void);
+
+	/**
+	 * @description: compute the enabled energy and fft in process from mono float PCM, as an alternative
+	 * to music_processor.py
+	 * @params sampleRate: of the samples that will be passed in
+	 * @return: number of samples per feature update
+	 */
+	int initSoundFeatureEngine(int sampleRate);
+
+	/**
+	 * @description: consume samples up to the end of the current feature update, or of the current fast hop
+	 * of a few ms. When the update completes, its features are served to the plugin as by updateRhythmFeatures
+	 * @params isUpdated: set if an update completed
+	 * @params rhythmFeatures: if not NULL, filled with the completed update as a feature source would send it,
+	 * see getSourceFftBins. Its bins stay valid until the next call
+	 * @return: number of samples consumed, fewer than nSamples if an update or a fast hop completed
+	 */
+	int processSoundSamples(const float* samples, int nSamples, bool* isUpdated, RhythmFeatures_t* rhythmFeatures);
+	void deinitSoundFeatureEngine(void);
+
+	/**
+	 * @description: whether the fast hop completed by the last processSoundSamples call held an onset.
+	 * The onset and the energy of the hop are already served to the plugin, through getIsOnset and getEnergy,
+	 * so the host can render a frame at once instead of waiting for the update to complete
+	 */
+	bool getIsFastOnset(void);
+
+	/**
+	 * @description: run the beat engine over a whole recording at once, e.g. to store its beat grid,
+	 * splitting it into segments that are analysed in parallel. Each segment starts the engine afresh
+	 * on the 20s before it, so the result is close to, but not exactly, that of a single pass.
+	 * Independent of the plugin's enabled features and of the live beat engine
+	 * @params energies, fftBins: one feature update per tick, nFftBins bins each
+	 * @params beats: filled with the beat features of every tick
+	 * @params nThreads: 0 or less to use every core
+	 * @return: number of ticks analysed
+	 */
+	int analyseFeatureBeats(const uint16_t* energies, const uint8_t* fftBins, int nFftBins, int nTicks, BeatFeatures_t* beats,
+			int nThreads);
+
+	/**
+	 * @description: as analyseFeatureBeats, with the features computed from mono float PCM as by the sound feature engine.
+	 * The beat engine runs on the plugin's bins, rebinned from the full resolution spectrum as they are live
+	 * @params beats: room for maxTicks ticks. If NULL, nothing is analysed and the number of ticks in the PCM is returned
+	 */
+	int analysePcmBeats(const float* samples, long nSamples, int sampleRate, BeatFeatures_t* beats, int maxTicks, int nThreads);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INC_PLUGINUTILITIES_H_ */
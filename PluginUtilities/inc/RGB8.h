@@ -0,0 +1,131 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * RGB8.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_RGB8_H_
+#define INC_RGB8_H_
+
+#include <stdint.h>
+#include "ColorUtils.h"
+
+/**
+ * A colour packed into one 4 byte word, for compositing whole frames. All operations saturate at 0 and 255
+ * and are inline, so blending a panel costs a few instructions rather than calls into the utilities library.
+ * The array kernels below treat the colours as plain bytes, written without branches or calls so that the
+ * compiler vectorizes them when optimizing (-O3); the example makefiles build at -O0, so a plugin that blends
+ * frames with them needs -O3 on its sources. The host's -m option builds them at -O3 and times a cross fade
+ * against the float blend plugins otherwise write
+ */
+struct RGB8_t {
+	uint8_t R, G, B;
+	uint8_t A;				/*pads the colour to a word; blended like the others, otherwise unused*/
+};
+
+/**
+ * @description: x / 255 rounded to nearest, for x up to 255 * 255
+ */
+inline uint8_t div255(uint32_t x){
+	return (uint8_t)((x + 128 + ((x + 128) >> 8)) >> 8);
+}
+
+inline uint8_t addSaturated(uint8_t a, uint8_t b){
+	uint32_t sum = (uint32_t)a + b;
+	return (uint8_t)((sum > 255) ? 255 : sum);
+}
+
+inline RGB8_t toRGB8(const RGB_t& c){
+	RGB_t l = (RGB_t){(c.R < 0) ? 0 : ((c.R > 255) ? 255 : c.R), (c.G < 0) ? 0 : ((c.G > 255) ? 255 : c.G),
+			(c.B < 0) ? 0 : ((c.B > 255) ? 255 : c.B)};
+	return (RGB8_t){(uint8_t)l.R, (uint8_t)l.G, (uint8_t)l.B, 0};
+}
+
+inline RGB_t toRGB(const RGB8_t& c){
+	return (RGB_t){c.R, c.G, c.B};
+}
+
+/**
+ * saturating add
+ */
+inline RGB8_t operator+ (const RGB8_t& l, const RGB8_t& r){
+	return (RGB8_t){addSaturated(l.R, r.R), addSaturated(l.G, r.G), addSaturated(l.B, r.B), addSaturated(l.A, r.A)};
+}
+
+/**
+ * @description: c * s / 255, e.g. to dim a colour to a brightness s
+ */
+inline RGB8_t scaleRGB8(const RGB8_t& c, uint8_t s){
+	return (RGB8_t){div255(c.R * s), div255(c.G * s), div255(c.B * s), div255(c.A * s)};
+}
+
+/**
+ * @description: from blended towards to by t / 255, from at t = 0 and to at t = 255
+ */
+inline RGB8_t lerpRGB8(const RGB8_t& from, const RGB8_t& to, uint8_t t){
+	return (RGB8_t){div255(from.R * (255 - t) + to.R * t), div255(from.G * (255 - t) + to.G * t),
+			div255(from.B * (255 - t) + to.B * t), div255(from.A * (255 - t) + to.A * t)};
+}
+
+/**
+ * @description: out[i] = a[i] + b[i], saturating. out may be a or b
+ */
+inline void addRGB8Array(const RGB8_t* a, const RGB8_t* b, RGB8_t* out, int n){
+	const uint8_t* x = (const uint8_t*)a;
+	const uint8_t* y = (const uint8_t*)b;
+	uint8_t* z = (uint8_t*)out;
+	for (int i = 0; i < 4 * n; i++){
+		z[i] = addSaturated(x[i], y[i]);
+	}
+}
+
+/**
+ * @description: out[i] = scaleRGB8(in[i], s). out may be in
+ */
+inline void scaleRGB8Array(const RGB8_t* in, uint8_t s, RGB8_t* out, int n){
+	const uint8_t* x = (const uint8_t*)in;
+	uint8_t* z = (uint8_t*)out;
+	for (int i = 0; i < 4 * n; i++){
+		z[i] = div255(x[i] * s);
+	}
+}
+
+/**
+ * @description: out[i] = lerpRGB8(from[i], to[i], t), e.g. to cross fade two frames. out may be from or to
+ */
+inline void lerpRGB8Array(const RGB8_t* from, const RGB8_t* to, uint8_t t, RGB8_t* out, int n){
+	const uint8_t* x = (const uint8_t*)from;
+	const uint8_t* y = (const uint8_t*)to;
+	uint8_t* z = (uint8_t*)out;
+	for (int i = 0; i < 4 * n; i++){
+		z[i] = div255(x[i] * (255 - t) + y[i] * t);
+	}
+}
+
+/**
+ * @description: out[i] = lerpRGB8(from, to, t[i]), one weight per colour, e.g. a gradient between
+ * two colours across the panels
+ */
+inline void lerpRGB8Weights(const RGB8_t& from, const RGB8_t& to, const uint8_t* t, RGB8_t* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = lerpRGB8(from, to, t[i]);
+	}
+}
+
+#endif /* INC_RGB8_H_ */
@@ -0,0 +1,51 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * RealFft.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_REALFFT_H_
+#define INC_REALFFT_H_
+
+/**
+ * Power spectrum of a real signal of power of two length n, computed with a complex fft of length n/2
+ * whose twiddle factors and bit reversal permutation are computed once by realFftInit
+ */
+class RealFft {
+	RealFft(const RealFft&) = delete;
+	int n;
+	float* twiddles;		/*cos, sin of -2*pi*j/(n/2) for j < n/4, interleaved*/
+	float* postTwiddles;	/*cos, sin of -2*pi*k/n for k < n/2, interleaved*/
+	int* bitReverse;
+	float* buffer;			/*n/2 complex values, interleaved*/
+	void complexFft();
+public:
+	RealFft();
+	~RealFft();
+	void realFftInit(int n);
+
+	/**
+	 * @description: |X[k]|^2 of the unnormalized transform of in
+	 * @params in: n samples
+	 * @params power: filled with n/2 values, for the bins 0 to n/2 - 1
+	 */
+	void realFftPower(const float* in, float* power);
+};
+
+#endif /* INC_REALFFT_H_ */
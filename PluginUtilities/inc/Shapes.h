@@ -0,0 +1,65 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * Shapes.h
+ *
+ *  Created on: Oct 15, 2026
+ *
+ *  The concrete shapes behind Panel::shape
+ */
+
+#ifndef INC_SHAPES_H_
+#define INC_SHAPES_H_
+
+#include "Shape.h"
+
+class Triangle : public Shape {
+	void calculateTriangleVertices();
+public:
+	Triangle(Point centroid, int orientation);
+	virtual ~Triangle();
+	virtual bool isPointInsideShape(Point p);
+	virtual void updateShape(Point* centroid, int* orientation);
+};
+
+class Square : public Shape {
+	void calculateSquareVertices();
+public:
+	Square(Point centroid, int orientation);
+	virtual ~Square();
+	virtual bool isPointInsideShape(Point p);
+	virtual void updateShape(Point* centroid, int* orientation);
+};
+
+/**
+ * The Rhythm module. It has no light of its own; it is modelled as a point.
+ */
+class RhythmShape : public Shape {
+public:
+	RhythmShape(Point centroid, int orientation);
+	virtual ~RhythmShape();
+	virtual bool isPointInsideShape(Point p);
+	virtual void updateShape(Point* centroid, int* orientation);
+};
+
+/**
+ * @description: create the shape for a given shapeType (see Shape.h)
+ * @return: the shape, or NULL if the shapeType is unknown
+ */
+Shape* createShape(int shapeType, Point centroid, int orientation);
+
+#endif /* INC_SHAPES_H_ */
@@ -0,0 +1,98 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SoundFeatureEngine.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_SOUNDFEATUREENGINE_H_
+#define INC_SOUNDFEATUREENGINE_H_
+
+#include <stdint.h>
+#include "Decimator.h"
+#include "FastOnsetDetector.h"
+#include "FftFilterbank.h"
+#include "PluginUtilities.h"
+#include "RealFft.h"
+
+/*same analysis as music_processor.py, so plugins see the same scale from either source*/
+#define SOUND_FEATURE_DECIMATION 4
+#define SOUND_FEATURE_FFT_SIZE 512			/*in decimated samples*/
+#define SOUND_FEATURE_FFT_SCALE 8.0f
+#define SOUND_FEATURE_ENERGY_SCALE 32.0f
+#define SOUND_FEATURE_ENERGY_WINDOW 2048	/*energy is normalized to music_processor.py's chunks of this many samples*/
+#define SOUND_FEATURE_FAST_HOPS 10			/*fast path hops per update, 5ms each at FEATURE_TICK_MS*/
+
+/**
+ * Computes energy and unsaturated fft bins from mono float PCM, one update per FEATURE_TICK_MS of samples.
+ * The samples are decimated as they stream in, and every update transforms the latest
+ * SOUND_FEATURE_FFT_SIZE decimated samples, so there is no per-chunk resampling.
+ * A fast path runs alongside on hops of a few ms, measuring their energy and detecting onsets
+ * in the time domain, so that hits are known long before the update that holds them completes
+ */
+class SoundFeatureEngine {
+	SoundFeatureEngine(const SoundFeatureEngine&) = delete;
+	Decimator* decimator;
+	RealFft* fft;
+	FftFilterbank* filterbank;
+	float* window;
+	float* decimated;			/*last SOUND_FEATURE_FFT_SIZE decimated samples, stored twice*/
+	int decimatedIndex;
+	float* decimatorOut;
+	float* frame;
+	float* power;
+	int hop;					/*input samples per update*/
+	int samplesInHop;
+	float energySum;
+	int fastHop;				/*index of the current fast hop within the update*/
+	float fastEnergySum;
+	bool fastUpdated;
+	uint16_t fastEnergy;
+	FastOnsetDetector* fastOnsetDetector;
+	int nFftBins;
+	int fftScale;
+	uint32_t sequence;
+	uint16_t energy;
+	float fftBins[MAX_FFT_BINS];				/*unsaturated, in the units of getFftBins*/
+	void pushDecimated(const float* samples, int nSamples);
+	void computeFeatures();
+public:
+	SoundFeatureEngine();
+	~SoundFeatureEngine();
+	void soundFeatureEngineInit(int sampleRate, int nFftBins, int fftScale);
+
+	/**
+	 * @description: consume samples until the end of the current update
+	 * @params isUpdated: set if an update completed
+	 * @params rhythmFeatures: filled when an update completes, with fftBinsF pointing into the engine.
+	 * The timestamp is the time of completion, when the last sample of the update has just been read
+	 * @return: number of samples consumed. Fewer than nSamples if an update or a fast hop completed
+	 */
+	int soundFeatureEngineProcess(const float* samples, int nSamples, bool* isUpdated, RhythmFeatures_t* rhythmFeatures);
+	int getHop();
+
+	/**
+	 * @description: the fast path, valid after soundFeatureEngineProcess completed a fast hop, which
+	 * the last hop of an update also does
+	 */
+	bool isFastUpdated();
+	bool isFastOnset();
+	uint16_t getFastEnergy();		/*energy of the last fast hop, in the units of the update's energy*/
+};
+
+#endif /* INC_SOUNDFEATUREENGINE_H_ */
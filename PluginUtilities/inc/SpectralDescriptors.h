@@ -0,0 +1,65 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SpectralDescriptors.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_SPECTRALDESCRIPTORS_H_
+#define INC_SPECTRALDESCRIPTORS_H_
+
+#define SPECTRAL_ROLLOFF_SHARE 0.85f		/*share of the spectrum's sum below the rolloff bin*/
+
+/**
+ * Summarizes the fft bins of every feature update: the strongest bin, the centroid, the flux from the
+ * previous update and the rolloff. The strongest bin and the centroid are also averaged over a window,
+ * which the library restarts after every beat
+ */
+class SpectralDescriptors {
+	SpectralDescriptors(const SpectralDescriptors&) = delete;
+	int nBins;
+	float* previous;			/*bins of the previous update, for the flux*/
+	bool isFirst;
+	int dominantBin;
+	float centroid;
+	float flux;
+	float rolloff;
+	float dominantBinSum;
+	float centroidSum;
+	int windowLength;
+	bool isWindowEnded;
+public:
+	SpectralDescriptors();
+	~SpectralDescriptors();
+	void spectralDescriptorsInit(int nBins);
+	void spectralDescriptorsUpdate(const float* bins);
+
+	/**
+	 * @description: start a new window with the next update, the current one stays readable until then
+	 */
+	void endWindow();
+
+	int getDominantBin();
+	float getCentroid();		/*in bins*/
+	float getFlux();
+	float getRolloff();			/*in bins*/
+	float getWindowDominantBin();
+	float getWindowCentroid();
+};
+
+#endif /* INC_SPECTRALDESCRIPTORS_H_ */
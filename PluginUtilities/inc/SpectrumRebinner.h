@@ -0,0 +1,64 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SpectrumRebinner.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_SPECTRUMREBINNER_H_
+#define INC_SPECTRUMREBINNER_H_
+
+#include <stdint.h>
+
+#define SPECTRUM_REBINNER_CACHE_SIZE 4		/*bin counts kept rebinned per update*/
+
+/**
+ * Serves one spectrum at any number of linear bins. Each update takes the prefix sums of the spectrum once,
+ * after which every output bin is the difference of two of them, whatever its width. Bins average equal
+ * chunks as music_processor.py and FftFilterbank do; asking for more bins than the spectrum has repeats them.
+ * The bins of the last few counts asked for are cached until the next update
+ */
+class SpectrumRebinner {
+	SpectrumRebinner(const SpectrumRebinner&) = delete;
+	int maxIn;
+	int nIn;
+	uint32_t generation;		/*counts updates, 0 marks an empty cache entry*/
+	double* prefix;				/*prefix[k] is the sum of the first k bins*/
+	int cacheCount[SPECTRUM_REBINNER_CACHE_SIZE];
+	uint32_t cacheGeneration[SPECTRUM_REBINNER_CACHE_SIZE];
+	float* cacheBins[SPECTRUM_REBINNER_CACHE_SIZE];
+	int nextEntry;
+public:
+	SpectrumRebinner();
+	~SpectrumRebinner();
+
+	/**
+	 * @params maxBins: largest number of bins that will be passed in or asked for
+	 */
+	void spectrumRebinnerInit(int maxBins);
+	void spectrumRebinnerUpdate(const float* bins, int nBins);
+
+	/**
+	 * @description: the spectrum of the last update as nOut linear bins, valid until the next update
+	 * or until SPECTRUM_REBINNER_CACHE_SIZE other counts have been asked for
+	 * @return: NULL if nOut is out of range or there has been no update
+	 */
+	const float* getBins(int nOut);
+};
+
+#endif /* INC_SPECTRUMREBINNER_H_ */
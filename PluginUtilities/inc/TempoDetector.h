@@ -0,0 +1,70 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * TempoDetector.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_TEMPODETECTOR_H_
+#define INC_TEMPODETECTOR_H_
+
+#include "Fifo.h"
+#include "Histogram.h"
+#include "OnsetDetector.h"
+
+#define TEMPO_MIN_INTERVAL 6			/*in ticks, 200 bpm at 50ms per tick*/
+#define TEMPO_MAX_INTERVAL 20			/*in ticks, 60 bpm at 50ms per tick*/
+#define TEMPO_ACF_LAGS (2 * TEMPO_MAX_INTERVAL + 1)	/*lags up to twice the longest interval, to score each interval's double*/
+#define TEMPO_MEAN_RATE 0.05f			/*rate at which the running mean removed from the novelty follows it*/
+#define TEMPO_DOUBLE_WEIGHT 0.5f		/*weight of the autocorrelation at twice an interval in its score*/
+#define TEMPO_PRIOR_OCTAVES 1.0f		/*spread of the preference for tempos near TEMPO_DEFAULT_BPM, in octaves*/
+#define TEMPO_SWITCH_RATIO 1.15f		/*another interval has to score this much higher to replace the current one*/
+#define TEMPO_DEFAULT_BPM 120.0f
+
+/**
+ * Estimates the tempo from the autocorrelation of the onset novelty. Each tick adds the products of the
+ * newest novelty with the TEMPO_ACF_LAGS before it to a lazily degrading histogram, TEMPO_ACF_LAGS
+ * multiply-adds whatever the length of the history. An interval scores by its own and its double's
+ * autocorrelation, weighted towards TEMPO_DEFAULT_BPM, and the current interval is kept unless another
+ * scores clearly higher, which keeps the tempo from jumping between octaves
+ */
+class TempoDetector {
+	TempoDetector(const TempoDetector&) = delete;
+	Histogram* autocorrelation;		/*bin k holds the degraded sum of novelty products k ticks apart*/
+	Fifo<float>* novelty;			/*the last TEMPO_ACF_LAGS novelty values, mean removed*/
+	float noveltyMean;
+	float prior[TEMPO_MAX_INTERVAL + 1];
+	int onsetInterval;
+	float tempo;
+	float confidence;
+	void updateAutocorrelation(OnsetDetector* onsetDetector);
+	float getScore(int interval);
+	void updateTempo();
+public:
+	TempoDetector();
+	~TempoDetector();
+	void tempoDetectorTick(OnsetDetector* onsetDetector);
+	int getOnsetInterval();		/*most likely beat interval, in ticks*/
+	float getTempo();
+	float getTempoConfidence();	/*normalized autocorrelation at the current interval, 0 to 1*/
+	void tempoDetectorPrint(int width);
+};
+
+float getBpmFromInterval(int interval);
+
+#endif /* INC_TEMPODETECTOR_H_ */
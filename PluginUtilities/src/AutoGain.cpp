@@ -0,0 +1,76 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * AutoGain.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "AutoGain.h"
+#include <math.h>
+#include <stddef.h>
+
+AutoGain::AutoGain(){
+	nChannels = 0;
+	target = 1;
+	attack = 1;
+	release = 1;
+	envelope = NULL;
+	gain = NULL;
+}
+
+AutoGain::~AutoGain(){
+	delete [] envelope;
+	delete [] gain;
+}
+
+static float getCoefficient(float timeMs, float tickMs){
+	return (timeMs > 0) ? 1 - expf(-tickMs / timeMs) : 1;
+}
+
+void AutoGain::autoGainInit(int _nChannels, float _target, float attackMs, float releaseMs, float tickMs){
+	delete [] envelope;
+	delete [] gain;
+	nChannels = _nChannels;
+	target = _target;
+	attack = getCoefficient(attackMs, tickMs);
+	release = getCoefficient(releaseMs, tickMs);
+	envelope = new float[nChannels];
+	gain = new float[nChannels];
+	autoGainReset();
+}
+
+void AutoGain::autoGainReset(void){
+	for (int i = 0; i < nChannels; i++){
+		envelope[i] = target;
+		gain[i] = 1;
+	}
+}
+
+void AutoGain::autoGainTrack(const float* levels){
+	for (int i = 0; i < nChannels; i++){
+		float level = levels[i];
+		float rate = (level > envelope[i]) ? attack : release;
+		envelope[i] += rate * (level - envelope[i]);
+		float g = (envelope[i] * AUTO_GAIN_MAX > target) ? target / envelope[i] : AUTO_GAIN_MAX;
+		gain[i] = (g < AUTO_GAIN_MIN) ? AUTO_GAIN_MIN : g;
+	}
+}
+
+float AutoGain::getGain(int channel){
+	return (channel >= 0 && channel < nChannels) ? gain[channel] : 1;
+}
@@ -0,0 +1,183 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * BeatAnalysis.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "BeatAnalysis.h"
+#include "BeatEngine.h"
+#include "FftFilterbank.h"
+#include "SoundFeatureEngine.h"
+#include "SpectrumRebinner.h"
+#include <atomic>
+#include <stddef.h>
+#include <thread>
+#include <vector>
+
+void analyseBeatSegment(const BeatAnalysisSource_t* source, int first, int last, BeatFeatures_t* beats){
+	int warmup = (first > BEAT_ANALYSIS_WARMUP_TICKS) ? first - BEAT_ANALYSIS_WARMUP_TICKS : 0;
+	int nFftBins = source->nFftBins;
+	BeatEngine* engine = new BeatEngine();
+	engine->beatEngineInit(nFftBins);
+
+	SoundFeatureEngine* soundEngine = NULL;
+	SpectrumRebinner* rebinner = NULL;
+	FftFilterbank* filterbank = NULL;
+	long sample = 0;
+	std::vector<uint8_t> bins(nFftBins > 0 ? nFftBins : 1);
+	std::vector<float> scaledBins(nFftBins > 0 ? nFftBins : 1);
+	if (source->samples){
+		soundEngine = new SoundFeatureEngine();
+		soundEngine->soundFeatureEngineInit(source->sampleRate, FFT_SPECTRUM_BINS, FFT_SCALE_LINEAR);
+		sample = (long)warmup * soundEngine->getHop();
+		if (source->fftScale != FFT_SCALE_LINEAR){
+			filterbank = new FftFilterbank();
+			filterbank->fftFilterbankInit(FFT_SPECTRUM_BINS, nFftBins, source->fftScale, FFT_SPECTRUM_HZ_PER_BIN);
+		}
+		else if (nFftBins != FFT_SPECTRUM_BINS){
+			rebinner = new SpectrumRebinner();
+			rebinner->spectrumRebinnerInit(MAX_FFT_BINS);
+		}
+	}
+
+	for (int tick = warmup; tick < last; tick++){
+		uint16_t energy;
+		uint8_t* fftBins;
+		if (soundEngine){
+			RhythmFeatures_t update;
+			bool isUpdated = false;
+			while (!isUpdated && sample < source->nSamples){
+				long n = source->nSamples - sample;
+				sample += soundEngine->soundFeatureEngineProcess(source->samples + sample, (n > INT32_MAX) ? INT32_MAX : n,
+						&isUpdated, &update);
+			}
+			if (!isUpdated){
+				break;
+			}
+			energy = update.energy;
+			const float* spectrum = update.fftBinsF;
+			if (filterbank){
+				filterbank->fftFilterbankApply(update.fftBinsF, scaledBins.data());
+				spectrum = scaledBins.data();
+			}
+			else if (rebinner){
+				rebinner->spectrumRebinnerUpdate(update.fftBinsF, FFT_SPECTRUM_BINS);
+				spectrum = rebinner->getBins(nFftBins);
+			}
+			for (int i = 0; i < nFftBins; i++){
+				bins[i] = (spectrum[i] > 255) ? 255 : (uint8_t)spectrum[i];
+			}
+			fftBins = bins.data();
+		}
+		else {
+			energy = source->energies[tick];
+			fftBins = const_cast<uint8_t*>(source->fftBins) + (size_t)tick * nFftBins;
+		}
+
+		engine->beatEngineTick(energy, fftBins);
+		if (tick >= first){
+			BeatFeatures_t* beat = beats + tick;
+			beat->isBeat = engine->isBeat();
+			beat->isOnset = engine->isOnset();
+			beat->tempo = engine->getTempo();
+			beat->confidence = engine->getConfidence();
+		}
+	}
+	delete filterbank;
+	delete rebinner;
+	delete soundEngine;
+	delete engine;
+}
+
+/**
+ * segments are handed out in order, so that the threads finish at about the same time
+ */
+void analyseBeatSegments(const BeatAnalysisSource_t* source, BeatFeatures_t* beats, int nThreads){
+	int nSegments = (source->nTicks + BEAT_ANALYSIS_SEGMENT_TICKS - 1) / BEAT_ANALYSIS_SEGMENT_TICKS;
+	if (nThreads <= 0){
+		nThreads = std::thread::hardware_concurrency();
+	}
+	if (nThreads > nSegments){
+		nThreads = nSegments;
+	}
+	std::atomic<int> next(0);
+	auto work = [&](){
+		int segment;
+		while ((segment = next++) < nSegments){
+			int first = segment * BEAT_ANALYSIS_SEGMENT_TICKS;
+			int last = (first + BEAT_ANALYSIS_SEGMENT_TICKS < source->nTicks) ? first + BEAT_ANALYSIS_SEGMENT_TICKS : source->nTicks;
+			analyseBeatSegment(source, first, last, beats);
+		}
+	};
+	std::vector<std::thread> threads;
+	for (int i = 1; i < nThreads; i++){
+		threads.push_back(std::thread(work));
+	}
+	work();
+	for (size_t i = 0; i < threads.size(); i++){
+		threads[i].join();
+	}
+}
+
+/* ----------------------------------
+ * HOST FACING
+ * ----------------------------------
+ */
+int analyseFeatureBeats(const uint16_t* energies, const uint8_t* fftBins, int nFftBins, int nTicks, BeatFeatures_t* beats,
+		int nThreads){
+	BeatAnalysisSource_t source;
+	source.energies = energies;
+	source.fftBins = fftBins;
+	source.nFftBins = nFftBins;
+	source.fftScale = FFT_SCALE_LINEAR;
+	source.samples = NULL;
+	source.nSamples = 0;
+	source.sampleRate = 0;
+	source.nTicks = nTicks;
+	analyseBeatSegments(&source, beats, nThreads);
+	return nTicks;
+}
+
+int analysePcmBeats(const float* samples, long nSamples, int sampleRate, BeatFeatures_t* beats, int maxTicks, int nThreads){
+	int hop = sampleRate * FEATURE_TICK_MS / 1000;
+	if (hop < 1){
+		hop = 1;
+	}
+	int nTicks = nSamples / hop;
+	if (beats == NULL){
+		return nTicks;
+	}
+	/*the bins the beat engine runs on live, which enableBeatFeatures requests if the plugin did not*/
+	const EnabledFeatures_t* features = getEnabledFeatures();
+	BeatAnalysisSource_t source;
+	source.energies = NULL;
+	source.fftBins = NULL;
+	source.nFftBins = features->nFftBins;
+	source.fftScale = features->fftScale;
+	if (!features->fft || features->nFftBins == 0){
+		source.nFftBins = BEAT_ENGINE_FFT_BINS;
+		source.fftScale = FFT_SCALE_LINEAR;
+	}
+	source.samples = samples;
+	source.nSamples = nSamples;
+	source.sampleRate = sampleRate;
+	source.nTicks = (nTicks < maxTicks) ? nTicks : maxTicks;
+	analyseBeatSegments(&source, beats, nThreads);
+	return source.nTicks;
+}
@@ -0,0 +1,122 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * BeatEngine.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "BeatEngine.h"
+#include <stddef.h>
+
+BeatEngine::BeatEngine(){
+	onsetDetector = NULL;
+	tempoDetector = NULL;
+	ticksSinceBeat = 0;
+	ticksSinceOnset = 0;
+	beat = false;
+}
+
+BeatEngine::~BeatEngine(){
+	if (onsetDetector){
+		delete onsetDetector;
+	}
+	if (tempoDetector){
+		delete tempoDetector;
+	}
+}
+
+void BeatEngine::beatEngineInit(int nFftBins){
+	if (onsetDetector){
+		delete onsetDetector;
+	}
+	if (tempoDetector){
+		delete tempoDetector;
+	}
+	onsetDetector = new OnsetDetector();
+	onsetDetector->onsetDetectorInit(nFftBins);
+	tempoDetector = new TempoDetector();
+	ticksSinceBeat = 0;
+	ticksSinceOnset = 0;
+	beat = false;
+}
+
+/**
+ * a beat is predicted one beat interval after the previous one. An onset close to the
+ * predicted beat pulls the beat onto the onset, so the beat grid follows the music.
+ */
+void BeatEngine::updateBeat(){
+	int interval = tempoDetector->getOnsetInterval();
+	bool onset = onsetDetector->isOnset();
+	ticksSinceBeat++;
+	ticksSinceOnset = onset ? 0 : ticksSinceOnset + 1;
+	beat = false;
+
+	if (onset && ticksSinceBeat >= interval - BEAT_SNAP_TICKS){
+		beat = true;
+	}
+	else if (ticksSinceBeat >= interval + BEAT_SNAP_TICKS && ticksSinceOnset < BEAT_SILENCE_INTERVALS * interval){
+		beat = true;
+	}
+	if (beat){
+		ticksSinceBeat = 0;
+	}
+}
+
+void BeatEngine::beatEngineTick(uint16_t energy, uint8_t* fftBins){
+	onsetDetector->onsetDetectorTick(energy, fftBins);
+	tempoDetector->tempoDetectorTick(onsetDetector);
+	updateBeat();
+}
+
+bool BeatEngine::isBeat(){
+	return beat;
+}
+
+bool BeatEngine::isOnset(){
+	return onsetDetector->isOnset();
+}
+
+float BeatEngine::getTempo(){
+	return tempoDetector->getTempo();
+}
+
+float BeatEngine::getTempoConfidence(){
+	return tempoDetector->getTempoConfidence();
+}
+
+/**
+ * the tempo estimate's confidence while beats are being predicted, 0 once they stopped for lack of onsets
+ */
+float BeatEngine::getConfidence(){
+	if (ticksSinceOnset >= BEAT_SILENCE_INTERVALS * tempoDetector->getOnsetInterval()){
+		return 0;
+	}
+	return tempoDetector->getTempoConfidence();
+}
+
+float BeatEngine::getNovelty(){
+	return onsetDetector->getNovelty();
+}
+
+float BeatEngine::getLowFrequencyNovelty(){
+	return onsetDetector->getLowFrequencyNovelty();
+}
+
+float BeatEngine::getOnsetNovelty(){
+	return onsetDetector->getOnsetNovelty();
+}
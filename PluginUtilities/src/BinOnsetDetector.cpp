@@ -0,0 +1,136 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * BinOnsetDetector.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "BinOnsetDetector.h"
+#include <stddef.h>
+#include <string.h>
+
+BinOnsetDetector::BinOnsetDetector(){
+	nBins = 0;
+	runningPeak = NULL;
+	minimum = NULL;
+	previous = NULL;
+	secondPrevious = NULL;
+	onset = NULL;
+	mask = NULL;
+}
+
+BinOnsetDetector::~BinOnsetDetector(){
+	delete [] runningPeak;
+	delete [] minimum;
+	delete [] previous;
+	delete [] secondPrevious;
+	delete [] onset;
+	delete [] mask;
+}
+
+void BinOnsetDetector::binOnsetDetectorInit(int _nBins){
+	delete [] runningPeak;
+	delete [] minimum;
+	delete [] previous;
+	delete [] secondPrevious;
+	delete [] onset;
+	delete [] mask;
+	nBins = _nBins;
+	int nWords = (nBins + 31) / 32;
+	runningPeak = new float[nBins];
+	minimum = new float[nBins];
+	previous = new float[nBins];
+	secondPrevious = new float[nBins];
+	onset = new float[nBins];
+	mask = new uint32_t[nWords > 0 ? nWords : 1];
+	for (int i = 0; i < nBins; i++){
+		runningPeak[i] = BIN_ONSET_INITIAL_PEAK;
+	}
+	memset(minimum, 0, nBins * sizeof(float));
+	memset(previous, 0, nBins * sizeof(float));
+	memset(secondPrevious, 0, nBins * sizeof(float));
+	memset(onset, 0, nBins * sizeof(float));
+	memset(mask, 0, (nWords > 0 ? nWords : 1) * sizeof(uint32_t));
+}
+
+/**
+ * a if isA, else b, chosen on the bits. The compiler cannot move the computation of either into a branch of its
+ * own, which under trapping floating point it could not turn back into a select
+ */
+static inline float selectFloat(int isA, float a, float b){
+	uint32_t ia, ib;
+	memcpy(&ia, &a, sizeof(ia));
+	memcpy(&ib, &b, sizeof(ib));
+	uint32_t mask = -(uint32_t)isA;
+	uint32_t i = (ia & mask) | (ib & ~mask);
+	float f;
+	memcpy(&f, &i, sizeof(f));
+	return f;
+}
+
+/**
+ * every comparison and every candidate value is computed for every bin and the branches of the per bin
+ * algorithm are made with selectFloat, so the loop has no control flow. The state arrays are separate
+ * allocations, as the restricted parameters tell the compiler, so it needs no overlap checks either, and the
+ * loop vectorizes; the file is built at -O3 for it
+ */
+static void tickBins(int nBins, const float* __restrict bins, float* __restrict runningPeak,
+		float* __restrict minimum, float* __restrict previous, float* __restrict secondPrevious,
+		float* __restrict onset){
+	for (int i = 0; i < nBins; i++){
+		float level = bins[i];
+		float peak = runningPeak[i];
+		float last = previous[i];
+		float low = minimum[i];
+
+		/*the previous level was a local peak: fold it into the running peak*/
+		int isPeak = (level + peak * BIN_ONSET_PEAK_DROP < last) & (last > secondPrevious[i]);
+		float trail = selectFloat(last > peak, BIN_ONSET_PEAK_TRAIL / 2, BIN_ONSET_PEAK_TRAIL);
+		float folded = peak - peak / BIN_ONSET_PEAK_TRAIL + last / trail;
+		peak = selectFloat(isPeak, folded, peak);
+
+		float decayed = low - BIN_ONSET_MINIMUM_DECAY;
+		decayed = selectFloat(decayed > 0, decayed, 0);
+		low = selectFloat(level < low, level, decayed);
+
+		int isOnset = level >= low + peak * BIN_ONSET_TRIGGER_RATIO + BIN_ONSET_MIN_RISE;
+		minimum[i] = selectFloat(isOnset, level, low);
+		runningPeak[i] = peak;
+		onset[i] = selectFloat(isOnset, 1.0f, 0.0f);
+		secondPrevious[i] = last;
+		previous[i] = level;
+	}
+}
+
+void BinOnsetDetector::binOnsetDetectorTick(const float* bins){
+	tickBins(nBins, bins, runningPeak, minimum, previous, secondPrevious, onset);
+
+	int nWords = (nBins + 31) / 32;
+	for (int w = 0; w < nWords; w++){
+		uint32_t word = 0;
+		int n = (nBins - w * 32 < 32) ? nBins - w * 32 : 32;
+		for (int j = 0; j < n; j++){
+			word |= (uint32_t)onset[w * 32 + j] << j;
+		}
+		mask[w] = word;
+	}
+}
+
+const uint32_t* BinOnsetDetector::getMask(){
+	return mask;
+}
@@ -0,0 +1,336 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * ColorUtils.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "ColorUtils.h"
+#include "LinearColor.h"
+#include "PluginUtilities.h"
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#define COLOR_BATCH_BLOCK 64		/*colours RGBtoHSVBatch splits into components at a time*/
+
+static int clampInt(int v, int lo, int hi){
+	return (v < lo) ? lo : ((v > hi) ? hi : v);
+}
+
+void parseColor(int* colorByteStream, int nColors, RGB_t** rgb){
+	*rgb = NULL;
+	if (nColors <= 0){
+		return;
+	}
+	*rgb = new RGB_t[nColors];
+	for (int i = 0; i < nColors; i++){
+		int* c = colorByteStream + i * PALETTE_INTS_PER_COLOR;
+		HSVtoRGB((HSV_t){c[0], c[1], c[2]}, &(*rgb)[i]);
+	}
+}
+
+/**
+ * H is in degrees, S and V are percentages. Out of range S and V are clamped.
+ */
+void HSVtoRGB(HSV_t hsv, RGB_t* rgb){
+	double h = fmod(fmod((double)hsv.H, 360.0) + 360.0, 360.0) / 60.0;
+	double s = clampInt(hsv.S, 0, 100) / 100.0;
+	double v = clampInt(hsv.V, 0, 100) / 100.0;
+	int sector = (int)floor(h);
+	double f = h - sector;
+	double p = v * (1.0 - s);
+	double q = v * (1.0 - s * f);
+	double t = v * (1.0 - s * (1.0 - f));
+	double r, g, b;
+
+	switch (sector){
+	case 0: r = v; g = t; b = p; break;
+	case 1: r = q; g = v; b = p; break;
+	case 2: r = p; g = v; b = t; break;
+	case 3: r = p; g = q; b = v; break;
+	case 4: r = t; g = p; b = v; break;
+	default: r = v; g = p; b = q; break;
+	}
+	rgb->R = (int)round(r * 255.0);
+	rgb->G = (int)round(g * 255.0);
+	rgb->B = (int)round(b * 255.0);
+}
+
+/**
+ * RGB components are clamped to [0, 255]
+ */
+void RGBtoHSV(RGB_t rgb, HSV_t* hsv){
+	double r = clampInt(rgb.R, 0, 255) / 255.0;
+	double g = clampInt(rgb.G, 0, 255) / 255.0;
+	double b = clampInt(rgb.B, 0, 255) / 255.0;
+	double max = fmax(r, fmax(g, b));
+	double min = fmin(r, fmin(g, b));
+	double delta = max - min;
+	double h = 0;
+
+	if (delta > 0){
+		if (max == r){
+			h = 60.0 * fmod((g - b) / delta, 6.0);
+		}
+		else if (max == g){
+			h = 60.0 * ((b - r) / delta + 2.0);
+		}
+		else {
+			h = 60.0 * ((r - g) / delta + 4.0);
+		}
+		if (h < 0){
+			h += 360.0;
+		}
+	}
+	hsv->H = (int)round(h) % 360;
+	hsv->S = (max > 0) ? (int)round(delta / max * 100.0) : 0;
+	hsv->V = (int)round(max * 100.0);
+}
+
+/**
+ * round of x >= 0, as round itself computes it: x - (int)x is exact and so is doubling it, so the fraction
+ * rounds up exactly when twice it truncates to 1
+ */
+static inline int roundPositive(double x){
+	int i = (int)x;
+	return i + (int)(2.0 * (x - i));
+}
+
+/**
+ * HSVtoRGB's component v * (1 - s * w), with w = a + b * f for the sector k counted from the component:
+ * 0 for v itself, 1 for p, f for q and 1 - f for t. The products and sums are exact, so the result is bit
+ * for bit HSVtoRGB's
+ */
+static inline double hsvComponent(int k, double f, double sat, double val){
+	int a = (unsigned)(k - 1) < 3;
+	int b = (k == 0) - (k == 3);
+	return val * (1.0 - sat * (a + b * f));
+}
+
+/**
+ * the arithmetic of HSVtoRGB, so the results are bit for bit the same: the hue is reduced with an exact
+ * truncating division, the sector switch becomes hsvComponent and rounding is done by roundPositive.
+ * The loop has no calls and no branches and vectorizes; ColorUtils.cpp is built at -O3 for it
+ */
+void HSVtoRGBBatch(const int* h, const int* s, const int* v, uint8_t* rgb, int n){
+	for (int i = 0; i < n; i++){
+		int hi = h[i] - 360 * (int)(h[i] / 360.0);
+		hi += 360 * (hi < 0);
+		int si = s[i];
+		int vi = v[i];
+		si = (si < 0) ? 0 : ((si > 100) ? 100 : si);
+		vi = (vi < 0) ? 0 : ((vi > 100) ? 100 : vi);
+		double hue = hi / 60.0;
+		double sat = si / 100.0;
+		double val = vi / 100.0;
+		int sector = (int)hue;
+		double f = hue - sector;
+		int kr = sector + 5 - 6 * (sector >= 1);
+		int kg = sector + 3 - 6 * (sector >= 3);
+		int kb = sector + 1 - 6 * (sector >= 5);
+		rgb[3 * i] = (uint8_t)roundPositive(hsvComponent(kr, f, sat, val) * 255.0);
+		rgb[3 * i + 1] = (uint8_t)roundPositive(hsvComponent(kg, f, sat, val) * 255.0);
+		rgb[3 * i + 2] = (uint8_t)roundPositive(hsvComponent(kb, f, sat, val) * 255.0);
+	}
+}
+
+/**
+ * as HSVtoRGBBatch, the arithmetic of RGBtoHSV without branches. Loads three bytes apart do not vectorize,
+ * so each block of colours is first split into one array per component. The largest and smallest components
+ * are found on the integers, before dividing by 255, which keeps their order. The hue of each sector is
+ * computed and the one of the largest component kept by weights of 0 or 1; |g - b| <= delta, so the fmod of
+ * RGBtoHSV never changes its argument, which is negative exactly when g < b. Divisors of 0 are made 1, where
+ * the dividend is 0 too
+ */
+void RGBtoHSVBatch(const uint8_t* rgb, int* h, int* s, int* v, int n){
+	int rs[COLOR_BATCH_BLOCK], gs[COLOR_BATCH_BLOCK], bs[COLOR_BATCH_BLOCK];
+	for (int start = 0; start < n; start += COLOR_BATCH_BLOCK){
+		int m = (n - start < COLOR_BATCH_BLOCK) ? n - start : COLOR_BATCH_BLOCK;
+		const uint8_t* in = rgb + 3 * start;
+		for (int i = 0; i < m; i++){
+			rs[i] = in[3 * i];
+			gs[i] = in[3 * i + 1];
+			bs[i] = in[3 * i + 2];
+		}
+		for (int i = 0; i < m; i++){
+			int ri = rs[i];
+			int gi = gs[i];
+			int bi = bs[i];
+			int maxi = (ri > gi) ? ri : gi;
+			maxi = (maxi > bi) ? maxi : bi;
+			int mini = (ri < gi) ? ri : gi;
+			mini = (mini < bi) ? mini : bi;
+			double r = ri / 255.0;
+			double g = gi / 255.0;
+			double b = bi / 255.0;
+			double max = maxi / 255.0;
+			double delta = max - mini / 255.0;
+			double divisor = delta + (maxi == mini);
+			double isR = (maxi == ri);
+			double isG = (maxi != ri) * (maxi == gi);
+			double isB = 1.0 - isR - isG;
+			double hue = 60.0 * ((g - b) / divisor) * isR + 60.0 * ((b - r) / divisor + 2.0) * isG +
+					60.0 * ((r - g) / divisor + 4.0) * isB;
+			hue += 360.0 * ((maxi == ri) * (gi < bi) * (maxi > mini));
+			int hr = roundPositive(hue) * (maxi > mini);
+			h[start + i] = hr - 360 * (hr >= 360);
+			s[start + i] = roundPositive(delta / (max + (maxi == 0)) * 100.0);
+			v[start + i] = roundPositive(max * 100.0);
+		}
+	}
+}
+
+void freeColor(RGB_t* rgb){
+	if (rgb){
+		delete [] rgb;
+	}
+}
+
+static double decodeGamma(int c){
+	double x = clampInt(c, 0, 255) / 255.0;
+	return (x <= 0.04045) ? x / 12.92 : pow((x + 0.055) / 1.055, 2.4);
+}
+
+static int encodeGamma(double x){
+	double c = (x <= 0.0031308) ? 12.92 * x : 1.055 * pow(x, 1 / 2.4) - 0.055;
+	return (int)round(c * 255.0);
+}
+
+uint16_t gammaDecodeTable[256];
+uint8_t gammaEncodeTable[1 << GAMMA_ENCODE_BITS];
+
+/**
+ * each encode entry covers a range of linear light and holds the sRGB value nearest to its centre. The dark
+ * end of sRGB is the steepest, a step of more than one entry per sRGB value, so every sRGB value decodes and
+ * encodes back to itself
+ */
+static bool fillGammaTables(void){
+	for (int i = 0; i < 256; i++){
+		gammaDecodeTable[i] = (uint16_t)round(decodeGamma(i) * LINEAR_ONE);
+	}
+	int shift = 16 - GAMMA_ENCODE_BITS;
+	for (int i = 0; i < (1 << GAMMA_ENCODE_BITS); i++){
+		double centre = ((i << shift) + (1 << shift) / 2.0) / LINEAR_ONE;
+		gammaEncodeTable[i] = clampInt(encodeGamma(centre), 0, 255);
+	}
+	return true;
+}
+
+static bool isGammaTablesFilled = fillGammaTables();
+
+/**
+ * grey has no hue of its own, it takes that of the colour it is blended with
+ */
+static RGB_t blendHSV(const RGB_t& from, const RGB_t& to, double f){
+	HSV_t a, b;
+	RGBtoHSV(from, &a);
+	RGBtoHSV(to, &b);
+	if (a.S == 0){
+		a.H = b.H;
+	}
+	if (b.S == 0){
+		b.H = a.H;
+	}
+	int dh = b.H - a.H;
+	dh += (dh > 180) ? -360 : ((dh < -180) ? 360 : 0);
+	HSV_t hsv = {(int)round(a.H + f * dh), (int)round(a.S + f * (b.S - a.S)), (int)round(a.V + f * (b.V - a.V))};
+	RGB_t rgb;
+	HSVtoRGB(hsv, &rgb);
+	return rgb;
+}
+
+static RGB_t blendColors(const RGB_t& from, const RGB_t& to, double f, int mode){
+	if (mode == PALETTE_LUT_HSV){
+		return blendHSV(from, to, f);
+	}
+	if (mode == PALETTE_LUT_GAMMA){
+		return (RGB_t){encodeGamma((1 - f) * decodeGamma(from.R) + f * decodeGamma(to.R)),
+				encodeGamma((1 - f) * decodeGamma(from.G) + f * decodeGamma(to.G)),
+				encodeGamma((1 - f) * decodeGamma(from.B) + f * decodeGamma(to.B))};
+	}
+	return (RGB_t){(int)round((1 - f) * from.R + f * to.R), (int)round((1 - f) * from.G + f * to.G),
+			(int)round((1 - f) * from.B + f * to.B)};
+}
+
+PaletteLUT::PaletteLUT(){
+	size = 0;
+	table = NULL;
+}
+
+PaletteLUT::~PaletteLUT(){
+	delete [] table;
+}
+
+void PaletteLUT::paletteLUTInit(const RGB_t* palette, int nColors, int _size, int mode){
+	delete [] table;
+	size = (_size > 1) ? _size : 2;
+	table = new uint8_t[3 * size];
+	if (palette == NULL || nColors <= 0){
+		memset(table, 128, 3 * size);
+		return;
+	}
+	for (int i = 0; i < size; i++){
+		double colour = (double)i / (size - 1) * (nColors - 1);
+		int index = (int)colour;
+		RGB_t rgb = (index >= nColors - 1) ? palette[nColors - 1] :
+				blendColors(palette[index], palette[index + 1], colour - index, mode);
+		rgb = limitRGB(rgb, 255, 0);
+		table[3 * i] = rgb.R;
+		table[3 * i + 1] = rgb.G;
+		table[3 * i + 2] = rgb.B;
+	}
+}
+
+void PaletteLUT::getRGBBatch(const float* positions, uint8_t* rgb, int n) const {
+	for (int j = 0; j < n; j++){
+		float x = positions[j] * (size - 1) + 0.5f;
+		int i = (x > 0) ? ((x < size - 1) ? (int)x : size - 1) : 0;
+		rgb[3 * j] = table[3 * i];
+		rgb[3 * j + 1] = table[3 * i + 1];
+		rgb[3 * j + 2] = table[3 * i + 2];
+	}
+}
+
+int PaletteLUT::getSize() const {
+	return size;
+}
+
+RGB_t operator+ (const RGB_t& l, const RGB_t& r){
+	return (RGB_t){l.R + r.R, l.G + r.G, l.B + r.B};
+}
+
+RGB_t operator- (const RGB_t& l, const RGB_t& r){
+	return (RGB_t){l.R - r.R, l.G - r.G, l.B - r.B};
+}
+
+RGB_t operator* (const RGB_t& l, int m){
+	return (RGB_t){l.R * m, l.G * m, l.B * m};
+}
+
+RGB_t operator* (int m, const RGB_t& l){
+	return l * m;
+}
+
+RGB_t operator/ (const RGB_t& l, float d){
+	return (RGB_t){(int)(l.R / d), (int)(l.G / d), (int)(l.B / d)};
+}
+
+RGB_t limitRGB(const RGB_t& c, int max, int min){
+	return (RGB_t){clampInt(c.R, min, max), clampInt(c.G, min, max), clampInt(c.B, min, max)};
+}
@@ -0,0 +1,63 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * DataManager.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "DataManager.h"
+#include "PluginUtilities.h"
+#include <stddef.h>
+
+static LayoutData* layoutData = NULL;
+static RGB_t* colorPalette = NULL;
+static int nPaletteColors = 0;
+
+const char* getPluginUtilitiesVersion(void){
+	return PLUGIN_UTILITIES_VERSION;
+}
+
+void passLayoutData(int* layoutDataByteStream, int nPanels){
+	parseLayoutData(layoutDataByteStream, nPanels, &layoutData);
+}
+
+void passColorPalette(int* colorByteStream, int nColors){
+	freeColor(colorPalette);
+	parseColor(colorByteStream, nColors, &colorPalette);
+	nPaletteColors = (colorPalette == NULL) ? 0 : nColors;
+}
+
+void dataManagerCleanup(void){
+	freeLayoutData(layoutData);
+	layoutData = NULL;
+	freeColor(colorPalette);
+	colorPalette = NULL;
+	nPaletteColors = 0;
+}
+
+void getColorPalette(RGB_t** palette, int* nColors){
+	*palette = colorPalette;
+	*nColors = nPaletteColors;
+}
+
+LayoutData* getLayoutData(){
+	if (layoutData == NULL){
+		layoutData = new LayoutData();
+	}
+	return layoutData;
+}
@@ -0,0 +1,91 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * Decimator.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "Decimator.h"
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+Decimator::Decimator(){
+	factor = 1;
+	nTaps = 0;
+	taps = NULL;
+	history = NULL;
+	historyIndex = 0;
+	phase = 0;
+}
+
+Decimator::~Decimator(){
+	delete [] taps;
+	delete [] history;
+}
+
+/**
+ * Blackman windowed sinc, normalized to unity gain at DC so that levels are kept
+ */
+void Decimator::decimatorInit(int _factor){
+	delete [] taps;
+	delete [] history;
+	factor = _factor;
+	nTaps = DECIMATOR_TAPS_PER_FACTOR * factor - 1;
+	taps = new float[nTaps];
+	history = new float[2 * nTaps];
+	memset(history, 0, 2 * nTaps * sizeof(float));
+	historyIndex = 0;
+	phase = 0;
+
+	double cutoff = 0.5 * DECIMATOR_PASSBAND / factor;
+	double centre = (nTaps - 1) / 2.0;
+	double sum = 0;
+	for (int i = 0; i < nTaps; i++){
+		double x = i - centre;
+		double sinc = (x == 0) ? 2 * cutoff : sin(2 * M_PI * cutoff * x) / (M_PI * x);
+		double window = 0.42 - 0.5 * cos(2 * M_PI * i / (nTaps - 1)) + 0.08 * cos(4 * M_PI * i / (nTaps - 1));
+		taps[i] = sinc * window;
+		sum += taps[i];
+	}
+	for (int i = 0; i < nTaps; i++){
+		taps[i] /= sum;
+	}
+}
+
+int Decimator::decimatorProcess(const float* in, int nIn, float* out){
+	int nOut = 0;
+	for (int i = 0; i < nIn; i++){
+		history[historyIndex] = in[i];
+		history[historyIndex + nTaps] = in[i];
+		historyIndex = (historyIndex + 1) % nTaps;
+		if (++phase < factor){
+			continue;
+		}
+		phase = 0;
+
+		/*history + historyIndex is the oldest of the last nTaps inputs*/
+		const float* x = history + historyIndex;
+		float acc = 0;
+		for (int j = 0; j < nTaps; j++){
+			acc += taps[j] * x[j];
+		}
+		out[nOut++] = acc;
+	}
+	return nOut;
+}
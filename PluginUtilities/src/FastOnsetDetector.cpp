@@ -0,0 +1,60 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FastOnsetDetector.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "FastOnsetDetector.h"
+#include <math.h>
+
+FastOnsetDetector::FastOnsetDetector(){
+	hopMs = 1;
+	rate = 1;
+	average = 0;
+	msSinceOnset = FAST_ONSET_REFRACTORY_MS;
+	onset = false;
+}
+
+void FastOnsetDetector::fastOnsetDetectorInit(float _hopMs){
+	hopMs = _hopMs;
+	rate = 1 - expf(-hopMs / FAST_ONSET_AVERAGE_MS);
+	average = 0;
+	msSinceOnset = FAST_ONSET_REFRACTORY_MS;
+	onset = false;
+}
+
+/**
+ * the hop is compared to the average before it is folded in, so that a hit does not raise its own threshold
+ */
+void FastOnsetDetector::fastOnsetDetectorTick(float energy){
+	float threshold = average * FAST_ONSET_THRESHOLD_RATIO;
+	if (threshold < FAST_ONSET_MIN_ENERGY){
+		threshold = FAST_ONSET_MIN_ENERGY;
+	}
+	msSinceOnset += hopMs;
+	onset = (energy > threshold) && (msSinceOnset >= FAST_ONSET_REFRACTORY_MS);
+	if (onset){
+		msSinceOnset = 0;
+	}
+	average += rate * (energy - average);
+}
+
+bool FastOnsetDetector::isOnset(){
+	return onset;
+}
@@ -0,0 +1,211 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FftFilterbank.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "FftFilterbank.h"
+#include "PluginFeatures.h"
+#include <math.h>
+#include <stddef.h>
+
+static float hzToMel(float hz){
+	return 2595.0f * log10f(1 + hz / 700.0f);
+}
+
+static float melToHz(float mel){
+	return 700.0f * (powf(10, mel / 2595.0f) - 1);
+}
+
+FftFilterbank::FftFilterbank(){
+	nOut = 0;
+	start = NULL;
+	offset = NULL;
+	weights = NULL;
+}
+
+FftFilterbank::~FftFilterbank(){
+	delete [] start;
+	delete [] offset;
+	delete [] weights;
+}
+
+void FftFilterbank::fftFilterbankInit(int nIn, int _nOut, int scale, float hzPerBin){
+	delete [] start;
+	delete [] offset;
+	delete [] weights;
+	nOut = _nOut;
+	start = new int[nOut];
+	offset = new int[nOut + 1];
+	if (scale == FFT_SCALE_LOG || scale == FFT_SCALE_MEL){
+		buildTriangular(nIn, scale, hzPerBin);
+	}
+	else {
+		buildLinear(nIn);
+	}
+}
+
+void FftFilterbank::fftFilterbankInitBands(int nIn, int _nOut, const float* edges, float hzPerBin){
+	delete [] start;
+	delete [] offset;
+	delete [] weights;
+	nOut = _nOut;
+	start = new int[nOut];
+	offset = new int[nOut + 1];
+	buildRectangular(nIn, edges, hzPerBin);
+}
+
+void FftFilterbank::setWeights(const std::vector<float>& sparse){
+	offset[nOut] = sparse.size();
+	weights = new float[sparse.size()];
+	for (size_t j = 0; j < sparse.size(); j++){
+		weights[j] = sparse[j];
+	}
+}
+
+/**
+ * bins beyond the last whole chunk are dropped, as in get_output_fft_bins
+ */
+void FftFilterbank::buildLinear(int nIn){
+	int step = nIn / nOut;
+	if (step < 1){
+		step = 1;
+	}
+	weights = new float[nOut * step];
+	for (int i = 0; i < nOut; i++){
+		int first = i * step;
+		if (first + step > nIn){
+			first = nIn - step;
+		}
+		start[i] = first;
+		offset[i] = i * step;
+		for (int j = 0; j < step; j++){
+			weights[i * step + j] = 1.0f / step;
+		}
+	}
+	offset[nOut] = nOut * step;
+}
+
+/**
+ * band edges are evenly spaced on the log or mel axis between FFT_FILTERBANK_MIN_HZ and the top bin.
+ * Output bin i rises from edge i to edge i + 1 and falls to edge i + 2. Bands narrower than an input
+ * bin fall between bin centres, those take the bin nearest to their centre
+ */
+void FftFilterbank::buildTriangular(int nIn, int scale, float hzPerBin){
+	std::vector<float> edges(nOut + 2);
+	float lo = FFT_FILTERBANK_MIN_HZ / hzPerBin;
+	float hi = nIn - 1;
+	if (lo > hi / 2){
+		lo = hi / 2;
+	}
+	for (int i = 0; i < nOut + 2; i++){
+		float t = (float)i / (nOut + 1);
+		if (scale == FFT_SCALE_LOG){
+			edges[i] = lo * powf(hi / lo, t);
+		}
+		else {
+			float melLo = hzToMel(lo * hzPerBin);
+			float melHi = hzToMel(hi * hzPerBin);
+			edges[i] = melToHz(melLo + t * (melHi - melLo)) / hzPerBin;
+		}
+	}
+
+	std::vector<float> sparse;
+	for (int i = 0; i < nOut; i++){
+		float left = edges[i];
+		float centre = edges[i + 1];
+		float right = edges[i + 2];
+		int first = (int)ceilf(left);
+		int last = (int)floorf(right);
+		if (last > nIn - 1){
+			last = nIn - 1;
+		}
+		std::vector<float> band;
+		float sum = 0;
+		for (int k = first; k <= last; k++){
+			float w = (k <= centre) ? (k - left) / (centre - left) : (right - k) / (right - centre);
+			band.push_back(w > 0 ? w : 0);
+			sum += band.back();
+		}
+		offset[i] = sparse.size();
+		if (sum <= 0){
+			int nearest = (int)(centre + 0.5f);
+			start[i] = (nearest > nIn - 1) ? nIn - 1 : nearest;
+			sparse.push_back(1);
+			continue;
+		}
+		start[i] = first;
+		for (size_t j = 0; j < band.size(); j++){
+			sparse.push_back(band[j] / sum);
+		}
+	}
+	setWeights(sparse);
+}
+
+/**
+ * a band outside the spectrum takes the nearest bin
+ */
+void FftFilterbank::buildRectangular(int nIn, const float* edges, float hzPerBin){
+	std::vector<float> sparse;
+	for (int i = 0; i < nOut; i++){
+		float left = edges[i] / hzPerBin;
+		float right = edges[i + 1] / hzPerBin;
+		int first = (int)floorf(left + 0.5f);
+		int last = (int)ceilf(right - 0.5f);
+		if (first < 0){
+			first = 0;
+		}
+		if (last > nIn - 1){
+			last = nIn - 1;
+		}
+		std::vector<float> band;
+		float sum = 0;
+		for (int k = first; k <= last; k++){
+			float lo = (k - 0.5f > left) ? k - 0.5f : left;
+			float hi = (k + 0.5f < right) ? k + 0.5f : right;
+			band.push_back(hi > lo ? hi - lo : 0);
+			sum += band.back();
+		}
+		offset[i] = sparse.size();
+		if (sum <= 0){
+			int nearest = (int)((left + right) / 2 + 0.5f);
+			start[i] = (nearest < 0) ? 0 : (nearest > nIn - 1) ? nIn - 1 : nearest;
+			sparse.push_back(1);
+			continue;
+		}
+		start[i] = first;
+		for (size_t j = 0; j < band.size(); j++){
+			sparse.push_back(band[j] / sum);
+		}
+	}
+	setWeights(sparse);
+}
+
+void FftFilterbank::fftFilterbankApply(const float* in, float* out){
+	for (int i = 0; i < nOut; i++){
+		const float* x = in + start[i];
+		const float* w = weights + offset[i];
+		int n = offset[i + 1] - offset[i];
+		float acc = 0;
+		for (int j = 0; j < n; j++){
+			acc += w[j] * x[j];
+		}
+		out[i] = acc;
+	}
+}
@@ -0,0 +1,274 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FixedPoint.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "FixedPoint.h"
+#include <math.h>
+
+uint32_t isqrtFixed(uint64_t x){
+	uint64_t root = 0;
+	uint64_t bit = (uint64_t)1 << 62;
+	while (bit > x){
+		bit >>= 2;
+	}
+	while (bit){
+		if (x >= root + bit){
+			x -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else {
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	return (uint32_t)root;
+}
+
+uint32_t isqrtFloat(uint64_t x){
+	return (uint32_t)floorl(sqrtl((long double)x));
+}
+
+/**
+ * the squared distance is in 32 fraction bits, so its square root is in 16
+ */
+q16_t distanceQ16Fixed(q16_t x1, q16_t y1, q16_t x2, q16_t y2){
+	int64_t dx = (int64_t)x2 - x1;
+	int64_t dy = (int64_t)y2 - y1;
+	return (q16_t)isqrtFixed((uint64_t)(dx * dx) + (uint64_t)(dy * dy));
+}
+
+q16_t distanceQ16Float(q16_t x1, q16_t y1, q16_t x2, q16_t y2){
+	long double dx = ((long double)x2 - x1) / Q16_ONE;
+	long double dy = ((long double)y2 - y1) / Q16_ONE;
+	return (q16_t)floorl(sqrtl(dx * dx + dy * dy) * Q16_ONE);
+}
+
+/**
+ * 1 + d * k is in 32 fraction bits; Q15_ONE divided by it, rounded half up, is floor((2^48 + den) / (2 * den))
+ */
+q15_t falloffQ15Fixed(q16_t d, q16_t k){
+	uint64_t den = ((uint64_t)Q16_ONE << 16) + (uint64_t)d * (uint64_t)k;
+	return (q15_t)((((uint64_t)1 << 48) + den) / (2 * den));
+}
+
+q15_t falloffQ15Float(q16_t d, q16_t k){
+	long double dk = ((long double)d / Q16_ONE) * ((long double)k / Q16_ONE);
+	return (q15_t)floorl(Q15_ONE / (1 + dk) + 0.5L);
+}
+
+int blendQ15Fixed(int a, int b, q15_t t){
+	return a + (int)(((int64_t)(b - a) * t) >> 15);
+}
+
+int blendQ15Float(int a, int b, q15_t t){
+	return (int)floorl(a + (b - a) * ((long double)t / Q15_ONE));
+}
+
+static RGB_t getPaletteRGBQ16(const RGB_t* palette, int nColors, q16_t position, int (*blend)(int, int, q15_t)){
+	if (nColors == 0){
+		return (RGB_t){128, 128, 128};
+	}
+	if (nColors == 1 || position <= 0){
+		return palette[0];
+	}
+	int idx = position >> 16;
+	if (idx >= nColors - 1){
+		return palette[nColors - 1];
+	}
+	q15_t t = (position & (Q16_ONE - 1)) >> 1;
+	const RGB_t& c1 = palette[idx];
+	const RGB_t& c2 = palette[idx + 1];
+	return (RGB_t){blend(c1.R, c2.R, t), blend(c1.G, c2.G, t), blend(c1.B, c2.B, t)};
+}
+
+RGB_t getPaletteRGBQ16Fixed(const RGB_t* palette, int nColors, q16_t position){
+	return getPaletteRGBQ16(palette, nColors, position, blendQ15Fixed);
+}
+
+RGB_t getPaletteRGBQ16Float(const RGB_t* palette, int nColors, q16_t position){
+	return getPaletteRGBQ16(palette, nColors, position, blendQ15Float);
+}
+
+#define LOG2_MANTISSA_BITS 62		/*fraction bits of the mantissa squared in log2Bits*/
+#define LOG2_RATIO_FAST_BITS 24		/*fraction bits of the logarithms divided in logRatioQ15Fixed, which settle most ratios*/
+#define LOG2_RATIO_BITS 56			/*fraction bits of the logarithms for the ratios the fast bits leave open*/
+
+/**
+ * y * y >> LOG2_MANTISSA_BITS, rounded down, from 32 bit halves so that no wider type is needed
+ */
+static uint64_t squareMantissa(uint64_t y){
+	uint64_t high = y >> 32;
+	uint64_t low = y & 0xFFFFFFFF;
+	uint64_t middle = high * low;
+	uint64_t lowProduct = low * low;
+	/*the sum of the bits below 2^64: the low product and the low halves of both middle products*/
+	uint64_t carry = ((lowProduct >> 32) + ((middle & 0x7FFFFFFF) << 1)) >> 32;
+	uint64_t top = high * high + (middle >> 31) + carry;
+	uint64_t bottom = lowProduct + (middle << 33);
+	return (top << (64 - LOG2_MANTISSA_BITS)) | (bottom >> LOG2_MANTISSA_BITS);
+}
+
+/**
+ * base 2 logarithm of x in nBits fraction bits, rounded down. The integer part is the position of the top bit.
+ * Squaring the mantissa, normalised to [1, 2), doubles its logarithm, so whether the square reaches 2 gives the
+ * next fraction bit. The squares are rounded down, so the result never exceeds the logarithm, and every
+ * rounding costs the logarithm less than 2^-61 times the weight of the bit being found: the result is within
+ * 2^-nBits + 2^-60 below the logarithm
+ */
+static uint64_t log2Bits(uint32_t x, int nBits){
+	int n = 31;
+	while (!(x & ((uint32_t)1 << n))){
+		n--;
+	}
+	uint64_t y = (uint64_t)x << (LOG2_MANTISSA_BITS - n);
+	uint64_t result = (uint64_t)n << nBits;
+	for (int i = nBits - 1; i >= 0; i--){
+		y = squareMantissa(y);
+		if (y >> (LOG2_MANTISSA_BITS + 1)){
+			y >>= 1;
+			result |= (uint64_t)1 << i;
+		}
+	}
+	return result;
+}
+
+/**
+ * rounded down and exact: log2Bits in 16 bits falls short of the next step only if the logarithm is within
+ * 2^-60 of it, which no 32 bit argument is; checked over all 2^31 mantissas
+ */
+q16_t log2Q16Fixed(uint32_t x){
+	if (x == 0){
+		return 0;
+	}
+	return (q16_t)log2Bits(x, 16);
+}
+
+q16_t log2Q16Float(uint32_t x){
+	if (x == 0){
+		return 0;
+	}
+	return (q16_t)floorl(log2l((long double)x) * Q16_ONE);
+}
+
+/**
+ * floor(a * Q15_ONE / b) for a < b, one quotient bit at a time, as b may use all but 3 bits
+ */
+static q15_t divideQ15(uint64_t a, uint64_t b){
+	q15_t quotient = 0;
+	for (int i = 0; i < 15; i++){
+		a <<= 1;
+		quotient <<= 1;
+		if (a >= b){
+			a -= b;
+			quotient |= 1;
+		}
+	}
+	return quotient;
+}
+
+/**
+ * base ^ exponent, or limit + 1 if that is more than limit
+ */
+static uint64_t powerUpTo(uint32_t base, int exponent, uint32_t limit){
+	uint64_t power = 1;
+	for (int i = 0; i < exponent; i++){
+		power *= base;
+		if (power > limit){
+			return (uint64_t)limit + 1;
+		}
+	}
+	return power;
+}
+
+/**
+ * whether log(x) / log(max) is exactly ratio / Q15_ONE. Reduced to p / q, it is when x ^ q = max ^ p, i.e. when
+ * x = b ^ p and max = b ^ q for some integer b, which needs q <= 32 as b is at least 2
+ */
+static bool isExactRatio(uint32_t x, uint32_t max, q15_t ratio){
+	int p = ratio;
+	int q = Q15_ONE;
+	while (p % 2 == 0 && q > 1){
+		p /= 2;
+		q /= 2;
+	}
+	if (q > 32){
+		return false;
+	}
+	/*b is the smallest base whose q-th power reaches max, found by bisection*/
+	uint32_t low = 2;
+	uint32_t high = 65536;
+	while (low < high){
+		uint32_t middle = (low + high) / 2;
+		if (powerUpTo(middle, q, max) < max){
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
+	}
+	return powerUpTo(low, q, max) == max && powerUpTo(low, p, x) == x;
+}
+
+/**
+ * rounded down and exact. The logarithms are each known to within 2 units of their last bit, which bounds the
+ * ratio. LOG2_RATIO_FAST_BITS settle it unless it is close to a step, and LOG2_RATIO_BITS unless it is within
+ * far less than a step of one: then the ratio is on the step exactly if x and max are powers of a common base,
+ * and otherwise the middle of the bounds decides
+ */
+q15_t logRatioQ15Fixed(uint32_t x, uint32_t max){
+	if (max <= 1 || x >= max){
+		return Q15_ONE;
+	}
+	if (x <= 1){
+		return 0;
+	}
+	uint64_t logX = 0;
+	uint64_t logMax = 0;
+	q15_t low = 0;
+	q15_t high = 0;
+	for (int nBits = LOG2_RATIO_FAST_BITS; nBits <= LOG2_RATIO_BITS; nBits += LOG2_RATIO_BITS - LOG2_RATIO_FAST_BITS){
+		logX = log2Bits(x, nBits);
+		logMax = log2Bits(max, nBits);
+		low = divideQ15(logX, logMax + 2);
+		high = (logX + 2 < logMax) ? divideQ15(logX + 2, logMax) : Q15_ONE - 1;
+		if (low == high){
+			return low;
+		}
+	}
+	if (isExactRatio(x, max, high)){
+		return high;
+	}
+	return (logX + 1 < logMax) ? divideQ15(logX + 1, logMax + 1) : Q15_ONE - 1;
+}
+
+q15_t logRatioQ15Float(uint32_t x, uint32_t max){
+	if (max <= 1 || x >= max){
+		return Q15_ONE;
+	}
+	if (x <= 1){
+		return 0;
+	}
+	long double ratio = log2l((long double)x) * Q15_ONE / log2l((long double)max);
+	/*powers of a common base land exactly on a step, which the rounded logarithms may miss by a few units in the
+	 *last place; no other arguments come that close to one*/
+	long double step = roundl(ratio);
+	return (q15_t)((fabsl(ratio - step) < 1e-12L) ? step : floorl(ratio));
+}
@@ -0,0 +1,108 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * Histogram.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "Histogram.h"
+#include <stdio.h>
+#include <string.h>
+
+Histogram::Histogram() : Histogram(HISTOGRAM_DEFAULT_LENGTH){
+}
+
+Histogram::Histogram(int _length){
+	length = _length;
+	bins = new float[length];
+	memset(bins, 0, sizeof(float) * length);
+	scale = 1;
+	total = 0;
+}
+
+Histogram::~Histogram(){
+	delete [] bins;
+}
+
+void Histogram::incrementHistogramBin(int bin){
+	addToHistogramBin(bin, 1.0f);
+}
+
+void Histogram::addToHistogramBin(int bin, float value){
+	if (bin >= 0 && bin < length){
+		bins[bin] += value / scale;
+		total += value / scale;
+	}
+}
+
+float Histogram::getHistogramBin(int bin){
+	if (bin < 0 || bin >= length){
+		return 0;
+	}
+	return bins[bin] * scale;
+}
+
+int Histogram::getLength(){
+	return length;
+}
+
+/**
+ * the stored bins only change once in a long while, when the scale is folded back into them
+ */
+void Histogram::degradeHistogram(){
+	scale *= HISTOGRAM_DEGRADE_FACTOR;
+	if (scale < HISTOGRAM_MIN_SCALE){
+		total = 0;
+		for (int i = 0; i < length; i++){
+			bins[i] *= scale;
+			total += bins[i];
+		}
+		scale = 1;
+	}
+}
+
+float Histogram::getProbabilityOfBins(int* _bins, int nBins){
+	if (total <= 0){
+		return 0;
+	}
+	float sum = 0;
+	for (int i = 0; i < nBins; i++){
+		if (_bins[i] >= 0 && _bins[i] < length){
+			sum += bins[_bins[i]];
+		}
+	}
+	return sum / total;
+}
+
+void Histogram::displayHistogram(int width){
+	float max = 0;
+	for (int i = 0; i < length; i++){
+		if (bins[i] > max){
+			max = bins[i];
+		}
+	}
+	/*the scale cancels out*/
+	for (int i = 0; i < length; i++){
+		int n = (max > 0) ? (int)(bins[i] / max * width) : 0;
+		printf("%3d |", i);
+		for (int j = 0; j < n; j++){
+			putchar('#');
+		}
+		putchar('\n');
+	}
+}
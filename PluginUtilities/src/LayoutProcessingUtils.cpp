@@ -0,0 +1,164 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * LayoutProcessingUtils.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "LayoutProcessingUtils.h"
+#include "PluginUtilities.h"
+#include "Shapes.h"
+#include <math.h>
+#include <float.h>
+
+#define FRAME_SLICE_SPACING_60 0.5			/*fraction of sideLength, for rotations that are multiples of 60 degrees*/
+#define FRAME_SLICE_SPACING_30 0.288		/*fraction of sideLength, otherwise*/
+
+/**
+ * bounding box of the panel centroids
+ */
+static void getBoundsOfAuroraSystem(Panel* panels, int nPanels, double* minX, double* maxX, double* minY, double* maxY){
+	*minX = DBL_MAX;
+	*maxX = -DBL_MAX;
+	*minY = DBL_MAX;
+	*maxY = -DBL_MAX;
+	for (int i = 0; i < nPanels; i++){
+		const Point& c = panels[i].shape->getCentroid();
+		*minX = fmin(*minX, c.x);
+		*maxX = fmax(*maxX, c.x);
+		*minY = fmin(*minY, c.y);
+		*maxY = fmax(*maxY, c.y);
+	}
+}
+
+static Point getLayoutGeometricCenter(LayoutData* layoutData){
+	if (layoutData->nPanels == 0){
+		return Point();
+	}
+	double minX, maxX, minY, maxY;
+	getBoundsOfAuroraSystem(layoutData->panels, layoutData->nPanels, &minX, &maxX, &minY, &maxY);
+	return Point((minX + maxX) / 2, (minY + maxY) / 2);
+}
+
+void parseLayoutData(int* layoutDataByteStream, int nPanels, LayoutData** layoutData){
+	if (*layoutData == NULL){
+		*layoutData = new LayoutData();
+	}
+	LayoutData* ld = *layoutData;
+	if (ld->panels){
+		delete [] ld->panels;
+		ld->panels = NULL;
+	}
+
+	ld->globalOrientation = layoutDataByteStream[0];
+	ld->panels = new Panel[nPanels];
+	int n = 0;
+	for (int i = 0; i < nPanels; i++){
+		int* p = layoutDataByteStream + 1 + i * LAYOUT_INTS_PER_PANEL;
+		Shape* shape = createShape(p[4], Point(p[1], p[2]), p[3]);
+		if (shape == NULL){
+			continue;
+		}
+		ld->panels[n].panelId = p[0];
+		ld->panels[n].shape = shape;
+		n++;
+	}
+	ld->nPanels = n;
+	ld->layoutGeometricCenter = getLayoutGeometricCenter(ld);
+}
+
+int rotateAuroraPanels(LayoutData* layoutData, int *angle_degrees){
+	int angle = (int)round(*angle_degrees / 30.0) * 30;
+	*angle_degrees = angle;
+	if (angle % 360 == 0){
+		return 0;
+	}
+
+	Point center = layoutData->layoutGeometricCenter;
+	for (int i = 0; i < layoutData->nPanels; i++){
+		Shape* shape = layoutData->panels[i].shape;
+		Point centroid = shape->getCentroid();
+		centroid = center + (centroid - center).rotate(angle);
+		int orientation = (shape->getOrientation() + angle) % 360;
+		if (orientation < 0){
+			orientation += 360;
+		}
+		shape->updateShape(&centroid, &orientation);
+	}
+	return 0;
+}
+
+void getFrameSlicesFromLayoutForTriangle(LayoutData* layoutData, FrameSlice_t** frameSlices, int* nFrameSlices, int totalAuroraRotation){
+	*frameSlices = NULL;
+	*nFrameSlices = 0;
+	if (layoutData->nPanels == 0){
+		return;
+	}
+
+	double spacing = Shape::sideLength;
+	spacing *= (totalAuroraRotation % 60 == 0) ? FRAME_SLICE_SPACING_60 : FRAME_SLICE_SPACING_30;
+
+	double minX, maxX, minY, maxY;
+	getBoundsOfAuroraSystem(layoutData->panels, layoutData->nPanels, &minX, &maxX, &minY, &maxY);
+	int nColumns = (int)round((maxX - minX) / spacing) + 1;
+
+	//bucket the panels into columns, then drop the columns that stayed empty
+	std::vector<std::vector<int> > columns(nColumns);
+	for (int i = 0; i < layoutData->nPanels; i++){
+		int column = (int)round((layoutData->panels[i].shape->getCentroid().x - minX) / spacing);
+		columns[column].push_back(layoutData->panels[i].panelId);
+	}
+	int nOccupied = 0;
+	for (int i = 0; i < nColumns; i++){
+		if (!columns[i].empty()){
+			nOccupied++;
+		}
+	}
+
+	*frameSlices = new FrameSlice_t[nOccupied];
+	for (int i = 0; i < nColumns; i++){
+		if (!columns[i].empty()){
+			(*frameSlices)[(*nFrameSlices)++].panelIds = columns[i];
+		}
+	}
+}
+
+bool isPointInsidePanel(Panel* panel, Point p){
+	return panel->shape->isPointInsideShape(p);
+}
+
+int pointInsideWhichPanel(LayoutData* layoutData, Point p){
+	for (int i = 0; i < layoutData->nPanels; i++){
+		if (isPointInsidePanel(&layoutData->panels[i], p)){
+			return layoutData->panels[i].panelId;
+		}
+	}
+	return -1;
+}
+
+void freeLayoutData(LayoutData* layoutData){
+	if (layoutData){
+		delete layoutData;
+	}
+}
+
+void freeFrameSlices(FrameSlice_t* frameSlices){
+	if (frameSlices){
+		delete [] frameSlices;
+	}
+}
@@ -0,0 +1,133 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * OnsetDetector.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "OnsetDetector.h"
+#include <stdio.h>
+#include <string.h>
+
+#define ENERGY_NOVELTY_SCALE (1.0f / 256)		/*brings the energy rise into the range of the spectral flux*/
+
+OnsetDetector::OnsetDetector(){
+	previousFft = NULL;
+	nFftBins = 0;
+	previousEnergy = 0;
+	novelty = 0;
+	lowFrequencyNovelty = 0;
+	onsetNovelty = 0;
+	onset = false;
+	ticksSinceOnset = ONSET_REFRACTORY_TICKS;
+	noveltyHistory = NULL;
+}
+
+OnsetDetector::~OnsetDetector(){
+	if (previousFft){
+		delete [] previousFft;
+	}
+	if (noveltyHistory){
+		delete noveltyHistory;
+	}
+}
+
+void OnsetDetector::onsetDetectorInit(int _nFftBins){
+	nFftBins = _nFftBins;
+	if (previousFft){
+		delete [] previousFft;
+	}
+	previousFft = new uint8_t[nFftBins];
+	memset(previousFft, 0, nFftBins);
+	if (noveltyHistory){
+		delete noveltyHistory;
+	}
+	noveltyHistory = new Fifo<float>(ONSET_HISTORY_LENGTH);
+}
+
+float accumulateFrequencyNovelty(uint8_t* fftBins, uint8_t* previousFft, int lo, int hi){
+	float sum = 0;
+	for (int i = lo; i < hi; i++){
+		int diff = fftBins[i] - previousFft[i];
+		if (diff > 0){
+			sum += diff;
+		}
+	}
+	return sum;
+}
+
+void OnsetDetector::updateNovelty(uint16_t energy, uint8_t* fftBins){
+	float energyNovelty = (energy > previousEnergy) ? (energy - previousEnergy) * ENERGY_NOVELTY_SCALE : 0;
+	lowFrequencyNovelty = 0;
+	novelty = energyNovelty;
+	if (fftBins && nFftBins > 0){
+		int loBoundary = (nFftBins + 3) / 4;
+		lowFrequencyNovelty = accumulateFrequencyNovelty(fftBins, previousFft, 0, loBoundary);
+		novelty += lowFrequencyNovelty + accumulateFrequencyNovelty(fftBins, previousFft, loBoundary, nFftBins);
+		memcpy(previousFft, fftBins, nFftBins);
+	}
+	previousEnergy = energy;
+}
+
+void OnsetDetector::onsetDetect(){
+	float threshold = noveltyHistory->getAverage() * ONSET_THRESHOLD_RATIO;
+	if (threshold < ONSET_MIN_NOVELTY){
+		threshold = ONSET_MIN_NOVELTY;
+	}
+	onset = (novelty > threshold) && (ticksSinceOnset >= ONSET_REFRACTORY_TICKS);
+	if (onset){
+		onsetNovelty = novelty;
+		ticksSinceOnset = 0;
+	}
+	else {
+		ticksSinceOnset++;
+	}
+	noveltyHistory->push(novelty);
+}
+
+void OnsetDetector::onsetDetectorTick(uint16_t energy, uint8_t* fftBins){
+	updateNovelty(energy, fftBins);
+	onsetDetect();
+}
+
+bool OnsetDetector::isOnset(){
+	return onset;
+}
+
+float OnsetDetector::getNovelty(){
+	return novelty;
+}
+
+float OnsetDetector::getLowFrequencyNovelty(){
+	return lowFrequencyNovelty;
+}
+
+float OnsetDetector::getOnsetNovelty(){
+	return onsetNovelty;
+}
+
+void OnsetDetector::onsetDetectorPrint(int width){
+	int n = (int)(novelty / 4);
+	if (n > width){
+		n = width;
+	}
+	for (int i = 0; i < n; i++){
+		putchar(onset ? '#' : '|');
+	}
+	putchar('\n');
+}
@@ -0,0 +1,748 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * PluginFeatures.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "PluginFeatures.h"
+#include "PluginUtilities.h"
+#include "AutoGain.h"
+#include "BeatEngine.h"
+#include "BinOnsetDetector.h"
+#include "FftFilterbank.h"
+#include "SoundFeatureEngine.h"
+#include "SpectralDescriptors.h"
+#include "SpectrumRebinner.h"
+#include <atomic>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+#define SNAPSHOT_INDEX 0x03
+#define SNAPSHOT_FRESH 0x04			/*the middle snapshot has not been read yet*/
+
+static EnabledFeatures_t enabledFeatures;
+static uint16_t energy = 0;
+static uint8_t fftBins[MAX_FFT_BINS];
+static uint8_t* fftBinsView = fftBins;		/*fftBins, or the host's buffer given to passRhythmFeatureView*/
+static uint16_t fftBins16[MAX_FFT_BINS];
+static float fftBinsF[MAX_FFT_BINS];
+static float wideBins[MAX_FFT_BINS];		/*narrower bins from the host, widened to float*/
+static bool isWideSource = false;			/*the bins arrived wider than 8 bits and fftBinsF holds them*/
+static bool isFftBins16Current = false;		/*the wider bins are derived from the widest on first use after an update*/
+static bool isFftBinsFCurrent = false;
+static uint8_t distance = 0;
+static uint8_t speed = 0;
+static uint64_t featureTimestamp = 0;
+static uint32_t featureSequence = 0;
+static BeatFeatures_t beatFeatures;
+static bool isFastOnset = false;			/*the feature engine's fast path found an onset in its latest hop*/
+static int ticksSinceBeat = 0;
+static BeatEngine* bep = NULL;
+static SoundFeatureEngine* sfep = NULL;
+static SpectrumRebinner* srp = NULL;		/*serves the spectrum sent by the feature source as linear bins of any count*/
+static bool isRebinnerCurrent = false;		/*srp holds the bins of the current update*/
+static FftFilterbank* fbp = NULL;			/*rebins the spectrum into log or mel spaced bins*/
+static FftFilterbank* bandp = NULL;			/*sums the spectrum into band energies*/
+static float bandEdges[MAX_ENERGY_BANDS + 1];
+static float bandEnergies[MAX_ENERGY_BANDS];
+static AutoGain* energyGainp = NULL;		/*set by enableAutoGain*/
+static bool isAutoGainEnabled = false;		/*the gains are created again if deinitRhythmFeatures freed them*/
+static AutoGain* fftGainp = NULL;			/*one channel for all bins, or one per bin*/
+static uint16_t autoGainAttackMs = 0;
+static uint16_t autoGainReleaseMs = 0;
+static bool isAutoGainPerBin = false;
+static SpectralDescriptors* sdp = NULL;		/*summarizes the plugin's bins once per update*/
+static BinOnsetDetector* bodp = NULL;
+
+/*triple buffer: the updating thread fills the back snapshot and swaps it with the middle one,
+ *the plugin swaps its front snapshot with the middle one if that is fresh*/
+static FeatureSnapshot_t snapshots[3];
+static int snapshotBack = 2;
+static std::atomic<uint8_t> snapshotMiddle(1);
+static int snapshotFront = 0;
+static uint32_t noBinOnsets[(MAX_FFT_BINS + 31) / 32];
+
+/**
+ * the source sends the full resolution spectrum, see getSourceFftBins. The plugin's bins are rebinned
+ * from it here, whatever their scale
+ */
+static void updateFilterbanks(void){
+	if (srp == NULL){
+		srp = new SpectrumRebinner();
+		srp->spectrumRebinnerInit(MAX_FFT_BINS);
+	}
+	if (fbp){
+		delete fbp;
+		fbp = NULL;
+	}
+	if (bandp){
+		delete bandp;
+		bandp = NULL;
+	}
+	if (getSourceFftBins(&enabledFeatures) != FFT_SPECTRUM_BINS){
+		return;
+	}
+	if (enabledFeatures.fft && enabledFeatures.nFftBins > 0 && enabledFeatures.fftScale != FFT_SCALE_LINEAR){
+		fbp = new FftFilterbank();
+		fbp->fftFilterbankInit(FFT_SPECTRUM_BINS, enabledFeatures.nFftBins, enabledFeatures.fftScale, FFT_SPECTRUM_HZ_PER_BIN);
+	}
+	if (enabledFeatures.nBands > 0){
+		bandp = new FftFilterbank();
+		bandp->fftFilterbankInitBands(FFT_SPECTRUM_BINS, enabledFeatures.nBands, bandEdges, FFT_SPECTRUM_HZ_PER_BIN);
+	}
+}
+
+/**
+ * per bin gains need one channel per bin, so they follow the plugin's bin count
+ */
+static void updateAutoGain(void){
+	if (energyGainp == NULL){
+		return;
+	}
+	energyGainp->autoGainInit(1, AUTO_GAIN_ENERGY_TARGET, autoGainAttackMs, autoGainReleaseMs, FEATURE_TICK_MS);
+	int nChannels = isAutoGainPerBin ? enabledFeatures.nFftBins : 1;
+	fftGainp->autoGainInit(nChannels > 0 ? nChannels : 1, AUTO_GAIN_FFT_TARGET, autoGainAttackMs, autoGainReleaseMs,
+			FEATURE_TICK_MS);
+}
+
+/**
+ * bring the plugin's float bins to the target level. Broadband gain follows the loudest bin, so that
+ * the shape of the spectrum is kept
+ */
+static void applyFftGain(int n){
+	if (isAutoGainPerBin){
+		fftGainp->autoGainTrack(fftBinsF);
+		for (int i = 0; i < n; i++){
+			fftBinsF[i] *= fftGainp->getGain(i);
+		}
+		return;
+	}
+	float loudest = 0;
+	for (int i = 0; i < n; i++){
+		loudest = (fftBinsF[i] > loudest) ? fftBinsF[i] : loudest;
+	}
+	fftGainp->autoGainTrack(&loudest);
+	float gain = fftGainp->getGain(0);
+	for (int i = 0; i < n; i++){
+		fftBinsF[i] *= gain;
+	}
+}
+
+/* ----------------------------------
+ * PLUGIN FACING
+ * ----------------------------------
+ */
+void enableEnergy(void){
+	enabledFeatures.energy = true;
+}
+
+void enableFft(uint16_t nFftBins){
+	if (nFftBins > MAX_FFT_BINS){
+		nFftBins = MAX_FFT_BINS;
+	}
+	enabledFeatures.fft = true;
+	enabledFeatures.nFftBins = nFftBins;
+	enabledFeatures.fftScale = FFT_SCALE_LINEAR;
+	updateFilterbanks();
+	updateAutoGain();
+}
+
+void enableFftScaled(uint16_t nFftBins, uint8_t scale){
+	enableFft(nFftBins);
+	if (scale != FFT_SCALE_LOG && scale != FFT_SCALE_MEL){
+		return;
+	}
+	enabledFeatures.fftScale = scale;
+	updateFilterbanks();
+}
+
+/**
+ * without edges, the bands are evenly spaced on a log axis from FFT_FILTERBANK_MIN_HZ to the top of the spectrum
+ */
+void enableBandEnergy(uint8_t nBands, const float* edges){
+	if (nBands > MAX_ENERGY_BANDS){
+		nBands = MAX_ENERGY_BANDS;
+	}
+	float top = FFT_SPECTRUM_BINS * FFT_SPECTRUM_HZ_PER_BIN;
+	for (int i = 0; nBands > 0 && i <= nBands; i++){
+		if (edges){
+			bandEdges[i] = edges[i];
+		}
+		else {
+			bandEdges[i] = FFT_FILTERBANK_MIN_HZ * powf(top / FFT_FILTERBANK_MIN_HZ, (float)i / nBands);
+		}
+	}
+	enabledFeatures.nBands = nBands;
+	memset(bandEnergies, 0, sizeof(bandEnergies));
+	updateFilterbanks();
+}
+
+static void createAutoGain(void){
+	if (energyGainp == NULL){
+		energyGainp = new AutoGain();
+		fftGainp = new AutoGain();
+	}
+	updateAutoGain();
+}
+
+void enableAutoGain(uint16_t attackMs, uint16_t releaseMs, bool isPerBin){
+	isAutoGainEnabled = true;
+	autoGainAttackMs = attackMs;
+	autoGainReleaseMs = releaseMs;
+	isAutoGainPerBin = isPerBin;
+	createAutoGain();
+}
+
+float getAutoGain(void){
+	return energyGainp ? energyGainp->getGain(0) : 1;
+}
+
+void enableDistance(void){
+	enabledFeatures.distance = true;
+}
+
+void enableSpeed(void){
+	enabledFeatures.speed = true;
+}
+
+uint16_t getEnergy(void){
+	return energy;
+}
+
+uint8_t *getFftBins(void){
+	return fftBinsView;
+}
+
+uint16_t *getFftBins16(void){
+	if (!isFftBins16Current){
+		for (int i = 0; i < enabledFeatures.nFftBins; i++){
+			if (isWideSource){
+				fftBins16[i] = (fftBinsF[i] > UINT16_MAX) ? UINT16_MAX : (uint16_t)fftBinsF[i];
+			}
+			else {
+				fftBins16[i] = fftBinsView[i];
+			}
+		}
+		isFftBins16Current = true;
+	}
+	return fftBins16;
+}
+
+float *getFftBinsF(void){
+	if (!isFftBinsFCurrent){
+		for (int i = 0; i < enabledFeatures.nFftBins; i++){
+			fftBinsF[i] = fftBinsView[i];
+		}
+		isFftBinsFCurrent = true;
+	}
+	return fftBinsF;
+}
+
+/**
+ * the bins are rebinned from the spectrum if the source sent it, otherwise from the plugin's own bins
+ */
+const float *getFftBinsRebinned(uint16_t nFftBins){
+	if (srp == NULL){
+		return NULL;
+	}
+	if (!isRebinnerCurrent){
+		srp->spectrumRebinnerUpdate(getFftBinsF(), enabledFeatures.nFftBins);
+		isRebinnerCurrent = true;
+	}
+	return srp->getBins(nFftBins);
+}
+
+float *getBandEnergies(void){
+	return bandEnergies;
+}
+
+uint16_t getDominantBin(void){
+	return sdp ? sdp->getDominantBin() : 0;
+}
+
+float getSpectralCentroid(void){
+	return sdp ? sdp->getCentroid() : 0;
+}
+
+float getSpectralFlux(void){
+	return sdp ? sdp->getFlux() : 0;
+}
+
+float getSpectralRolloff(void){
+	return sdp ? sdp->getRolloff() : 0;
+}
+
+float getBeatWindowDominantBin(void){
+	return sdp ? sdp->getWindowDominantBin() : 0;
+}
+
+float getBeatWindowCentroid(void){
+	return sdp ? sdp->getWindowCentroid() : 0;
+}
+
+const uint32_t *getBinOnsetMask(void){
+	return bodp ? bodp->getMask() : noBinOnsets;
+}
+
+bool getIsBinOnset(uint16_t bin){
+	if (bin >= enabledFeatures.nFftBins){
+		return false;
+	}
+	return (getBinOnsetMask()[bin / 32] >> (bin % 32)) & 1;
+}
+
+bool getFeatureSnapshot(const FeatureSnapshot_t** snapshot){
+	bool isFresh = (snapshotMiddle.load(std::memory_order_relaxed) & SNAPSHOT_FRESH) != 0;
+	if (isFresh){
+		snapshotFront = snapshotMiddle.exchange(snapshotFront, std::memory_order_acq_rel) & SNAPSHOT_INDEX;
+	}
+	*snapshot = &snapshots[snapshotFront];
+	return isFresh;
+}
+
+uint8_t getDistance(void){
+	return distance;
+}
+
+uint8_t getSpeed(void){
+	return speed;
+}
+
+uint64_t getFeatureTimestamp(void){
+	return featureTimestamp;
+}
+
+uint32_t getFeatureSequence(void){
+	return featureSequence;
+}
+
+/**
+ * the beat engine runs on energy and fft, request them if the plugin did not
+ */
+void enableBeatFeatures(void){
+	enabledFeatures.beatFeatures = true;
+	enabledFeatures.energy = true;
+	if (!enabledFeatures.fft){
+		enabledFeatures.fft = true;
+		enabledFeatures.nFftBins = BEAT_ENGINE_FFT_BINS;
+		updateFilterbanks();
+	}
+}
+
+bool getIsBeat(void){
+	return beatFeatures.isBeat;
+}
+
+/**
+ * the feature engine's fast path finds hits sooner than the beat engine, which finds onsets the fast path
+ * misses, or comes from a beat grid, so either counts
+ */
+bool getIsOnset(void){
+	return isFastOnset || beatFeatures.isOnset;
+}
+
+float getTempo(void){
+	return beatFeatures.tempo;
+}
+
+/**
+ * beat features passed in by the host carry only the beat confidence
+ */
+float getTempoConfidence(void){
+	if (bep){
+		return bep->getTempoConfidence();
+	}
+	return beatFeatures.confidence;
+}
+
+/**
+ * the beat interval in ticks, recovered from the tempo so that beat features passed in by the host
+ * are served like those of the beat engine
+ */
+static float getBeatInterval(void){
+	if (beatFeatures.tempo <= 0){
+		return 0;
+	}
+	return 60000.0f / (beatFeatures.tempo * FEATURE_TICK_MS);
+}
+
+float getBeatPhase(void){
+	float interval = getBeatInterval();
+	if (interval <= 0){
+		return 0;
+	}
+	float phase = ticksSinceBeat / interval;
+	return (phase < 1) ? phase : 1;
+}
+
+float getTimeToNextBeat(void){
+	float interval = getBeatInterval();
+	if (interval <= ticksSinceBeat){
+		return 0;
+	}
+	return (interval - ticksSinceBeat) * FEATURE_TICK_MS;
+}
+
+float getBeatConfidence(void){
+	return beatFeatures.confidence;
+}
+
+/* ----------------------------------
+ * HOST FACING
+ * ----------------------------------
+ */
+const EnabledFeatures_t* getEnabledFeatures(void){
+	return &enabledFeatures;
+}
+
+/**
+ * clear the features of the last update, keeping what the plugin enabled
+ */
+static void resetRhythmFeatures(void){
+	energy = 0;
+	memset(fftBins, 0, sizeof(fftBins));
+	fftBinsView = fftBins;
+	isWideSource = false;
+	isFftBins16Current = false;
+	isFftBinsFCurrent = false;
+	isRebinnerCurrent = false;
+	isFastOnset = false;
+	distance = 0;
+	speed = 0;
+	if (energyGainp){
+		energyGainp->autoGainReset();
+		fftGainp->autoGainReset();
+	}
+	featureTimestamp = 0;
+	featureSequence = 0;
+	memset(bandEnergies, 0, sizeof(bandEnergies));
+	memset(snapshots, 0, sizeof(snapshots));
+	snapshotBack = 2;
+	snapshotMiddle.store(1);
+	snapshotFront = 0;
+}
+
+static void freeRhythmFeatures(void){
+	if (sdp){
+		delete sdp;
+		sdp = NULL;
+	}
+	if (bodp){
+		delete bodp;
+		bodp = NULL;
+	}
+	if (srp){
+		delete srp;
+		srp = NULL;
+	}
+	if (fbp){
+		delete fbp;
+		fbp = NULL;
+	}
+	if (bandp){
+		delete bandp;
+		bandp = NULL;
+	}
+	if (energyGainp){
+		delete energyGainp;
+		energyGainp = NULL;
+	}
+	if (fftGainp){
+		delete fftGainp;
+		fftGainp = NULL;
+	}
+}
+
+/**
+ * the rebinner, filterbanks and gains are created by the enable functions, and again here after deinitRhythmFeatures
+ */
+void initRhythmFeatures(void){
+	if (srp == NULL && (enabledFeatures.fft || enabledFeatures.nBands > 0)){
+		updateFilterbanks();
+	}
+	if (isAutoGainEnabled && energyGainp == NULL){
+		createAutoGain();
+	}
+	resetRhythmFeatures();
+	if (sdp){
+		delete sdp;
+		sdp = NULL;
+	}
+	if (bodp){
+		delete bodp;
+		bodp = NULL;
+	}
+	if (enabledFeatures.fft && enabledFeatures.nFftBins > 0){
+		sdp = new SpectralDescriptors();
+		sdp->spectralDescriptorsInit(enabledFeatures.nFftBins);
+		bodp = new BinOnsetDetector();
+		bodp->binOnsetDetectorInit(enabledFeatures.nFftBins);
+	}
+}
+
+/**
+ * once per update: after the beat features if the plugin has them, otherwise after the rhythm features
+ */
+static void publishSnapshot(void){
+	FeatureSnapshot_t* snapshot = &snapshots[snapshotBack];
+	snapshot->timestamp = featureTimestamp;
+	snapshot->sequence = featureSequence;
+	snapshot->energy = energy;
+	snapshot->nFftBins = enabledFeatures.nFftBins;
+	memcpy(snapshot->fftBins, fftBinsView, enabledFeatures.nFftBins);
+	snapshot->isBeat = beatFeatures.isBeat;
+	snapshot->isOnset = getIsOnset();
+	snapshot->tempo = beatFeatures.tempo;
+	snapshot->beatPhase = getBeatPhase();
+	snapshot->timeToNextBeat = getTimeToNextBeat();
+	snapshot->beatConfidence = beatFeatures.confidence;
+	snapshotBack = snapshotMiddle.exchange(snapshotBack | SNAPSHOT_FRESH, std::memory_order_acq_rel) & SNAPSHOT_INDEX;
+}
+
+/**
+ * 8 bit bins are stored as they are. Wider or rebinned bins go through fftBinsF, from which the
+ * 8 bit bins are saturated once per update
+ * @params isSpectrum: the bins are the full resolution spectrum, to be rebinned and summed into bands
+ */
+static void storeRhythmFeatures(const RhythmFeatures_t* rhythmFeatures, bool isSpectrum){
+	energy = rhythmFeatures->energy;
+	if (energyGainp){
+		float level = energy;
+		energyGainp->autoGainTrack(&level);
+		level *= energyGainp->getGain(0);
+		energy = (level > UINT16_MAX) ? UINT16_MAX : (uint16_t)(level + 0.5f);
+	}
+	distance = rhythmFeatures->distance;
+	speed = rhythmFeatures->speed;
+	featureTimestamp = rhythmFeatures->timestamp;
+	featureSequence = rhythmFeatures->sequence;
+	fftBinsView = fftBins;
+	isFftBins16Current = false;
+	isFftBinsFCurrent = false;
+	isRebinnerCurrent = false;
+
+	int n = rhythmFeatures->nFftBins;
+	if (n > MAX_FFT_BINS){
+		n = MAX_FFT_BINS;
+	}
+	const float* wide = rhythmFeatures->fftBinsF;
+	if (wide == NULL && rhythmFeatures->fftBins16){
+		for (int i = 0; i < n; i++){
+			wideBins[i] = rhythmFeatures->fftBins16[i];
+		}
+		wide = wideBins;
+	}
+	else if (wide == NULL && rhythmFeatures->fftBins && (isSpectrum || fftGainp)){
+		for (int i = 0; i < n; i++){
+			wideBins[i] = rhythmFeatures->fftBins[i];
+		}
+		wide = wideBins;
+	}
+
+	if (isSpectrum && wide && bandp){
+		bandp->fftFilterbankApply(wide, bandEnergies);
+	}
+
+	isWideSource = wide != NULL;
+	if (wide == NULL){
+		if (rhythmFeatures->fftBins){
+			memcpy(fftBins, rhythmFeatures->fftBins, n);
+		}
+		return;
+	}
+	if (isSpectrum){
+		srp->spectrumRebinnerUpdate(wide, n);
+		isRebinnerCurrent = true;
+		const float* linear = srp->getBins(enabledFeatures.nFftBins);
+		if (fbp){
+			fbp->fftFilterbankApply(wide, fftBinsF);
+		}
+		else if (linear){
+			memcpy(fftBinsF, linear, enabledFeatures.nFftBins * sizeof(float));
+		}
+		n = (fbp || linear) ? enabledFeatures.nFftBins : 0;
+	}
+	else {
+		memcpy(fftBinsF, wide, n * sizeof(float));
+	}
+	if (fftGainp){
+		applyFftGain(n);
+	}
+	for (int i = 0; i < n; i++){
+		fftBins[i] = (fftBinsF[i] > 255) ? 255 : (uint8_t)fftBinsF[i];
+	}
+	isFftBinsFCurrent = true;
+}
+
+static void updateSpectralDescriptors(void){
+	if (sdp){
+		sdp->spectralDescriptorsUpdate(getFftBinsF());
+	}
+	if (bodp){
+		bodp->binOnsetDetectorTick(getFftBinsF());
+	}
+}
+
+void updateRhythmFeatures(const RhythmFeatures_t* rhythmFeatures){
+	/*bins at the plugin's own linear resolution, e.g. from an older trace, are served as they are,
+	and so are bins sent to a plugin that enabled neither fft bins nor bands*/
+	bool isSpectrum = srp && rhythmFeatures->nFftBins == FFT_SPECTRUM_BINS &&
+			(fbp || bandp || enabledFeatures.nFftBins != FFT_SPECTRUM_BINS);
+	storeRhythmFeatures(rhythmFeatures, isSpectrum);
+	updateSpectralDescriptors();
+	if (!enabledFeatures.beatFeatures){
+		publishSnapshot();
+	}
+}
+
+/**
+ * plugins get a non-const pointer from getFftBins, so the host's buffer has to tolerate writes
+ */
+void passRhythmFeatureView(const RhythmFeatures_t* rhythmFeatures){
+	if (rhythmFeatures->fftBins == NULL || rhythmFeatures->fftBins16 || rhythmFeatures->fftBinsF ||
+			rhythmFeatures->nFftBins != enabledFeatures.nFftBins || fbp || bandp || energyGainp){
+		updateRhythmFeatures(rhythmFeatures);
+		return;
+	}
+	energy = rhythmFeatures->energy;
+	fftBinsView = const_cast<uint8_t*>(rhythmFeatures->fftBins);
+	isWideSource = false;
+	isFftBins16Current = false;
+	isFftBinsFCurrent = false;
+	isRebinnerCurrent = false;
+	distance = rhythmFeatures->distance;
+	speed = rhythmFeatures->speed;
+	featureTimestamp = rhythmFeatures->timestamp;
+	featureSequence = rhythmFeatures->sequence;
+	updateSpectralDescriptors();
+	if (!enabledFeatures.beatFeatures){
+		publishSnapshot();
+	}
+}
+
+void deinitRhythmFeatures(void){
+	freeRhythmFeatures();
+	resetRhythmFeatures();
+}
+
+/**
+ * a beat restarts the phase and the beat window of the spectral descriptors. A beat predicted late,
+ * by up to BEAT_SNAP_TICKS, leaves the phase at 1 until it arrives
+ */
+static void advanceBeat(void){
+	ticksSinceBeat = beatFeatures.isBeat ? 0 : ticksSinceBeat + 1;
+	if (beatFeatures.isBeat && sdp){
+		sdp->endWindow();
+	}
+}
+
+void initBeatFeatures(void){
+	if (bep){
+		delete bep;
+	}
+	ticksSinceBeat = 0;
+	bep = new BeatEngine();
+	bep->beatEngineInit(enabledFeatures.nFftBins);
+}
+
+void updateBeatFeatures(void){
+	if (bep){
+		bep->beatEngineTick(energy, fftBinsView);
+		beatFeatures.isBeat = bep->isBeat();
+		beatFeatures.isOnset = bep->isOnset();
+		beatFeatures.tempo = bep->getTempo();
+		beatFeatures.confidence = bep->getConfidence();
+		advanceBeat();
+		publishSnapshot();
+	}
+}
+
+void deinitBeatFeatures(void){
+	if (bep){
+		delete bep;
+		bep = NULL;
+	}
+	beatFeatures = BeatFeatures_t();
+	ticksSinceBeat = 0;
+}
+
+void passBeatFeatures(const BeatFeatures_t* _beatFeatures){
+	beatFeatures = *_beatFeatures;
+	advanceBeat();
+	if (enabledFeatures.beatFeatures){
+		publishSnapshot();
+	}
+}
+
+const BeatFeatures_t* getBeatFeatures(void){
+	return &beatFeatures;
+}
+
+int initSoundFeatureEngine(int sampleRate){
+	if (sfep){
+		delete sfep;
+	}
+	sfep = new SoundFeatureEngine();
+	/*the engine sends what a feature source would, the library rebins it as it does for music_processor.py*/
+	sfep->soundFeatureEngineInit(sampleRate, getSourceFftBins(&enabledFeatures), FFT_SCALE_LINEAR);
+	return sfep->getHop();
+}
+
+int processSoundSamples(const float* samples, int nSamples, bool* isUpdated, RhythmFeatures_t* rhythmFeatures){
+	*isUpdated = false;
+	if (sfep == NULL){
+		return nSamples;
+	}
+	RhythmFeatures_t update;
+	int n = sfep->soundFeatureEngineProcess(samples, nSamples, isUpdated, &update);
+	if (sfep->isFastUpdated()){
+		isFastOnset = sfep->isFastOnset();
+	}
+	if (isFastOnset && sfep->isFastUpdated() && !*isUpdated){
+		/*serve the hit at once, the update restores the energy of the whole tick*/
+		if (enabledFeatures.energy){
+			float level = sfep->getFastEnergy() * getAutoGain();
+			energy = (level > UINT16_MAX) ? UINT16_MAX : (uint16_t)(level + 0.5f);
+		}
+		publishSnapshot();
+	}
+	if (*isUpdated){
+		if (!enabledFeatures.energy){
+			update.energy = 0;
+		}
+		updateRhythmFeatures(&update);
+		if (rhythmFeatures){
+			*rhythmFeatures = update;
+		}
+	}
+	return n;
+}
+
+void deinitSoundFeatureEngine(void){
+	if (sfep){
+		delete sfep;
+		sfep = NULL;
+	}
+	isFastOnset = false;
+}
+
+bool getIsFastOnset(void){
+	return sfep && sfep->isFastOnset();
+}
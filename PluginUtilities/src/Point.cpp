@@ -0,0 +1,74 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * Point.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "Point.h"
+#include <math.h>
+#include <stdio.h>
+
+Point::Point(){
+	x = 0;
+	y = 0;
+}
+
+Point::Point(double _x, double _y){
+	x = _x;
+	y = _y;
+}
+
+Point Point::operator+(Point p2){
+	return Point(x + p2.x, y + p2.y);
+}
+
+Point Point::operator-(Point p2){
+	return Point(x - p2.x, y - p2.y);
+}
+
+void Point::ToInt(int* _x, int* _y){
+	*_x = (int)round(x);
+	*_y = (int)round(y);
+}
+
+/**
+ * rotates the point about the origin, counter-clockwise
+ */
+Point Point::rotate(degrees angle){
+	radians a = degs2rads(angle);
+	double c = cos(a);
+	double s = sin(a);
+	return Point(x * c - y * s, x * s + y * c);
+}
+
+std::string Point::ToString(){
+	char buf[64];
+	sprintf(buf, "(%.2f, %.2f)", x, y);
+	return std::string(buf);
+}
+
+double Point::distance(Point P1, Point P2){
+	double dx = P2.x - P1.x;
+	double dy = P2.y - P1.y;
+	return sqrt(dx * dx + dy * dy);
+}
+
+double degs2rads(double degs){
+	return degs * M_PI / 180.0;
+}
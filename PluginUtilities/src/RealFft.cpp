@@ -0,0 +1,130 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * RealFft.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "RealFft.h"
+#include <math.h>
+#include <stddef.h>
+
+RealFft::RealFft(){
+	n = 0;
+	twiddles = NULL;
+	postTwiddles = NULL;
+	bitReverse = NULL;
+	buffer = NULL;
+}
+
+RealFft::~RealFft(){
+	delete [] twiddles;
+	delete [] postTwiddles;
+	delete [] bitReverse;
+	delete [] buffer;
+}
+
+void RealFft::realFftInit(int _n){
+	delete [] twiddles;
+	delete [] postTwiddles;
+	delete [] bitReverse;
+	delete [] buffer;
+	n = _n;
+	int m = n / 2;
+	twiddles = new float[m];
+	postTwiddles = new float[n];
+	bitReverse = new int[m];
+	buffer = new float[n];
+
+	for (int j = 0; j < m / 2; j++){
+		twiddles[2 * j] = cos(-2 * M_PI * j / m);
+		twiddles[2 * j + 1] = sin(-2 * M_PI * j / m);
+	}
+	for (int k = 0; k < m; k++){
+		postTwiddles[2 * k] = cos(-2 * M_PI * k / n);
+		postTwiddles[2 * k + 1] = sin(-2 * M_PI * k / n);
+	}
+	int bits = 0;
+	while ((1 << bits) < m){
+		bits++;
+	}
+	for (int i = 0; i < m; i++){
+		int r = 0;
+		for (int b = 0; b < bits; b++){
+			r |= ((i >> b) & 1) << (bits - 1 - b);
+		}
+		bitReverse[i] = r;
+	}
+}
+
+/**
+ * in place iterative radix 2 decimation in time, on input that is already in bit reversed order
+ */
+void RealFft::complexFft(){
+	int m = n / 2;
+	for (int size = 2; size <= m; size *= 2){
+		int half = size / 2;
+		int stride = m / size;
+		for (int start = 0; start < m; start += size){
+			for (int j = 0; j < half; j++){
+				float wr = twiddles[2 * j * stride];
+				float wi = twiddles[2 * j * stride + 1];
+				float* a = buffer + 2 * (start + j);
+				float* b = buffer + 2 * (start + j + half);
+				float tr = wr * b[0] - wi * b[1];
+				float ti = wr * b[1] + wi * b[0];
+				b[0] = a[0] - tr;
+				b[1] = a[1] - ti;
+				a[0] += tr;
+				a[1] += ti;
+			}
+		}
+	}
+}
+
+/**
+ * the even samples go into the real and the odd samples into the imaginary parts of a half length
+ * complex transform Z, from which X[k] = E[k] + W^k O[k] with
+ * E[k] = (Z[k] + conj(Z[m-k])) / 2 and O[k] = -i (Z[k] - conj(Z[m-k])) / 2
+ */
+void RealFft::realFftPower(const float* in, float* power){
+	int m = n / 2;
+	for (int i = 0; i < m; i++){
+		int r = bitReverse[i];
+		buffer[2 * r] = in[2 * i];
+		buffer[2 * r + 1] = in[2 * i + 1];
+	}
+	complexFft();
+
+	for (int k = 0; k < m; k++){
+		int l = (m - k) % m;
+		float zr = buffer[2 * k];
+		float zi = buffer[2 * k + 1];
+		float cr = buffer[2 * l];
+		float ci = -buffer[2 * l + 1];
+		float er = 0.5f * (zr + cr);
+		float ei = 0.5f * (zi + ci);
+		float or_ = 0.5f * (zi - ci);
+		float oi = -0.5f * (zr - cr);
+		float wr = postTwiddles[2 * k];
+		float wi = postTwiddles[2 * k + 1];
+		float xr = er + wr * or_ - wi * oi;
+		float xi = ei + wr * oi + wi * or_;
+		power[k] = xr * xr + xi * xi;
+	}
+}
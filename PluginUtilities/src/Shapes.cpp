@@ -0,0 +1,178 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * Shapes.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "Shapes.h"
+#include <math.h>
+#include <stddef.h>
+
+#define POINT_INSIDE_THRESHOLD 1e-6
+#define RHYTHM_SHAPE_RADIUS 10.0
+
+int Shape::sideLength = 150;
+
+Shape::Shape(){
+	orientation = 0;
+	vertices = NULL;
+	nVertices = 0;
+	area = 0;
+	shapeType = -1;
+}
+
+Shape::~Shape(){
+	if (vertices){
+		delete [] vertices;
+		vertices = NULL;
+	}
+}
+
+const Point& Shape::getCentroid() const {
+	return centroid;
+}
+
+int Shape::getOrientation() const {
+	return orientation;
+}
+
+/**
+ * place nVertices vertices on the circumcircle of radius circumradius, the first one at firstVertexAngle
+ */
+static void placeRegularVertices(Point* vertices, int nVertices, Point centroid, double circumradius, double firstVertexAngle){
+	for (int i = 0; i < nVertices; i++){
+		Point v(circumradius, 0);
+		vertices[i] = centroid + v.rotate(firstVertexAngle + i * 360.0 / nVertices);
+	}
+}
+
+/**
+ * true if p is on the left of, or on, every edge of the counter-clockwise polygon
+ */
+static bool isPointInsideConvexPolygon(Point* vertices, int nVertices, Point p){
+	for (int i = 0; i < nVertices; i++){
+		Point a = vertices[i];
+		Point b = vertices[(i + 1) % nVertices];
+		double cross = (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+		if (cross < -POINT_INSIDE_THRESHOLD){
+			return false;
+		}
+	}
+	return true;
+}
+
+Triangle::Triangle(Point _centroid, int _orientation){
+	centroid = _centroid;
+	orientation = _orientation;
+	shapeType = SHAPE_TRIANGLE;
+	nVertices = 3;
+	vertices = new Point[nVertices];
+	area = sqrt(3.0) / 4.0 * sideLength * sideLength;
+	calculateTriangleVertices();
+}
+
+Triangle::~Triangle(){
+}
+
+/**
+ * with orientation 0 the base is parallel to the x-axis and the apex points up
+ */
+void Triangle::calculateTriangleVertices(){
+	placeRegularVertices(vertices, nVertices, centroid, sideLength / sqrt(3.0), orientation + 90.0);
+}
+
+bool Triangle::isPointInsideShape(Point p){
+	return isPointInsideConvexPolygon(vertices, nVertices, p);
+}
+
+void Triangle::updateShape(Point* _centroid, int* _orientation){
+	if (_centroid){
+		centroid = *_centroid;
+	}
+	if (_orientation){
+		orientation = *_orientation;
+	}
+	calculateTriangleVertices();
+}
+
+Square::Square(Point _centroid, int _orientation){
+	centroid = _centroid;
+	orientation = _orientation;
+	shapeType = SHAPE_SQUARE;
+	nVertices = 4;
+	vertices = new Point[nVertices];
+	area = (double)sideLength * sideLength;
+	calculateSquareVertices();
+}
+
+Square::~Square(){
+}
+
+void Square::calculateSquareVertices(){
+	placeRegularVertices(vertices, nVertices, centroid, sideLength / sqrt(2.0), orientation + 45.0);
+}
+
+bool Square::isPointInsideShape(Point p){
+	return isPointInsideConvexPolygon(vertices, nVertices, p);
+}
+
+void Square::updateShape(Point* _centroid, int* _orientation){
+	if (_centroid){
+		centroid = *_centroid;
+	}
+	if (_orientation){
+		orientation = *_orientation;
+	}
+	calculateSquareVertices();
+}
+
+RhythmShape::RhythmShape(Point _centroid, int _orientation){
+	centroid = _centroid;
+	orientation = _orientation;
+	shapeType = SHAPE_RHYTHM;
+}
+
+RhythmShape::~RhythmShape(){
+}
+
+bool RhythmShape::isPointInsideShape(Point p){
+	return Point::distance(centroid, p) <= RHYTHM_SHAPE_RADIUS;
+}
+
+void RhythmShape::updateShape(Point* _centroid, int* _orientation){
+	if (_centroid){
+		centroid = *_centroid;
+	}
+	if (_orientation){
+		orientation = *_orientation;
+	}
+}
+
+Shape* createShape(int shapeType, Point centroid, int orientation){
+	switch (shapeType){
+	case SHAPE_TRIANGLE:
+		return new Triangle(centroid, orientation);
+	case SHAPE_RHYTHM:
+		return new RhythmShape(centroid, orientation);
+	case SHAPE_SQUARE:
+		return new Square(centroid, orientation);
+	default:
+		return NULL;
+	}
+}
@@ -0,0 +1,213 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SoundFeatureEngine.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "SoundFeatureEngine.h"
+#include <chrono>
+#include <math.h>
+#include <stddef.h>
+#include <string.h>
+
+SoundFeatureEngine::SoundFeatureEngine(){
+	decimator = NULL;
+	fft = NULL;
+	filterbank = NULL;
+	window = NULL;
+	decimated = NULL;
+	decimatedIndex = 0;
+	decimatorOut = NULL;
+	frame = NULL;
+	power = NULL;
+	hop = 0;
+	samplesInHop = 0;
+	energySum = 0;
+	fastHop = 0;
+	fastEnergySum = 0;
+	fastUpdated = false;
+	fastEnergy = 0;
+	fastOnsetDetector = NULL;
+	nFftBins = 0;
+	fftScale = FFT_SCALE_LINEAR;
+	sequence = 0;
+	energy = 0;
+	memset(fftBins, 0, sizeof(fftBins));
+}
+
+SoundFeatureEngine::~SoundFeatureEngine(){
+	delete decimator;
+	delete fft;
+	delete filterbank;
+	delete [] window;
+	delete [] decimated;
+	delete [] decimatorOut;
+	delete [] frame;
+	delete [] power;
+	delete fastOnsetDetector;
+}
+
+void SoundFeatureEngine::soundFeatureEngineInit(int sampleRate, int _nFftBins, int _fftScale){
+	nFftBins = (_nFftBins > MAX_FFT_BINS) ? MAX_FFT_BINS : _nFftBins;
+	fftScale = _fftScale;
+	hop = sampleRate * FEATURE_TICK_MS / 1000;
+	if (hop < 1){
+		hop = 1;
+	}
+	samplesInHop = 0;
+	energySum = 0;
+	sequence = 0;
+	fastHop = 0;
+	fastEnergySum = 0;
+	fastUpdated = false;
+	fastEnergy = 0;
+	delete fastOnsetDetector;
+	fastOnsetDetector = new FastOnsetDetector();
+	fastOnsetDetector->fastOnsetDetectorInit((float)FEATURE_TICK_MS / SOUND_FEATURE_FAST_HOPS);
+
+	delete decimator;
+	decimator = new Decimator();
+	decimator->decimatorInit(SOUND_FEATURE_DECIMATION);
+	delete fft;
+	fft = new RealFft();
+	fft->realFftInit(SOUND_FEATURE_FFT_SIZE);
+	delete filterbank;
+	filterbank = new FftFilterbank();
+	if (nFftBins > 0){
+		float hzPerBin = (float)sampleRate / SOUND_FEATURE_DECIMATION / SOUND_FEATURE_FFT_SIZE;
+		filterbank->fftFilterbankInit(SOUND_FEATURE_FFT_SIZE / 2, nFftBins, fftScale, hzPerBin);
+	}
+
+	/*periodic Hann, like librosa.stft*/
+	delete [] window;
+	window = new float[SOUND_FEATURE_FFT_SIZE];
+	for (int i = 0; i < SOUND_FEATURE_FFT_SIZE; i++){
+		window[i] = 0.5f - 0.5f * cos(2 * M_PI * i / SOUND_FEATURE_FFT_SIZE);
+	}
+	delete [] decimated;
+	decimated = new float[2 * SOUND_FEATURE_FFT_SIZE];
+	memset(decimated, 0, 2 * SOUND_FEATURE_FFT_SIZE * sizeof(float));
+	decimatedIndex = 0;
+	delete [] decimatorOut;
+	decimatorOut = new float[hop / SOUND_FEATURE_DECIMATION + 1];
+	delete [] frame;
+	frame = new float[SOUND_FEATURE_FFT_SIZE];
+	delete [] power;
+	power = new float[SOUND_FEATURE_FFT_SIZE / 2];
+	energy = 0;
+	memset(fftBins, 0, sizeof(fftBins));
+}
+
+void SoundFeatureEngine::pushDecimated(const float* samples, int nSamples){
+	for (int i = 0; i < nSamples; i++){
+		decimated[decimatedIndex] = samples[i];
+		decimated[decimatedIndex + SOUND_FEATURE_FFT_SIZE] = samples[i];
+		decimatedIndex = (decimatedIndex + 1) % SOUND_FEATURE_FFT_SIZE;
+	}
+}
+
+/**
+ * the bins are rebinned from the lower half spectrum, linear bins as get_output_fft_bins in music_processor.py.
+ * Saturation is left to the utilities library, which serves the bins at each width
+ */
+void SoundFeatureEngine::computeFeatures(){
+	float e = energySum * SOUND_FEATURE_ENERGY_SCALE * SOUND_FEATURE_ENERGY_WINDOW / hop;
+	energy = (e > UINT16_MAX) ? UINT16_MAX : (uint16_t)e;
+
+	if (nFftBins == 0){
+		return;
+	}
+	const float* latest = decimated + decimatedIndex;
+	for (int i = 0; i < SOUND_FEATURE_FFT_SIZE; i++){
+		frame[i] = latest[i] * window[i];
+	}
+	fft->realFftPower(frame, power);
+
+	for (int i = 0; i < FFT_SPECTRUM_BINS; i++){
+		power[i] *= SOUND_FEATURE_FFT_SCALE;
+	}
+	filterbank->fftFilterbankApply(power, fftBins);
+}
+
+/**
+ * the fast hops split the update as evenly as its length allows, the last one ends with the update
+ */
+int SoundFeatureEngine::soundFeatureEngineProcess(const float* samples, int nSamples, bool* isUpdated,
+		RhythmFeatures_t* rhythmFeatures){
+	int fastHopStart = fastHop * hop / SOUND_FEATURE_FAST_HOPS;
+	int fastHopEnd = (fastHop + 1) * hop / SOUND_FEATURE_FAST_HOPS;
+	int n = fastHopEnd - samplesInHop;
+	if (n > nSamples){
+		n = nSamples;
+	}
+	float sum = 0;
+	for (int i = 0; i < n; i++){
+		sum += samples[i] * samples[i];
+	}
+	energySum += sum;
+	fastEnergySum += sum;
+	if (nFftBins > 0){
+		int nDecimated = decimator->decimatorProcess(samples, n, decimatorOut);
+		pushDecimated(decimatorOut, nDecimated);
+	}
+	samplesInHop += n;
+
+	fastUpdated = false;
+	if (samplesInHop == fastHopEnd && fastHopEnd > fastHopStart){
+		float e = fastEnergySum * SOUND_FEATURE_ENERGY_SCALE * SOUND_FEATURE_ENERGY_WINDOW / (fastHopEnd - fastHopStart);
+		fastEnergy = (e > UINT16_MAX) ? UINT16_MAX : (uint16_t)e;
+		fastOnsetDetector->fastOnsetDetectorTick(e);
+		fastEnergySum = 0;
+		fastUpdated = true;
+	}
+	if (samplesInHop == fastHopEnd){
+		fastHop = (fastHop + 1) % SOUND_FEATURE_FAST_HOPS;
+	}
+
+	*isUpdated = false;
+	if (samplesInHop == hop){
+		rhythmFeatures->timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+				std::chrono::steady_clock::now().time_since_epoch()).count();
+		computeFeatures();
+		samplesInHop = 0;
+		energySum = 0;
+		rhythmFeatures->energy = energy;
+		rhythmFeatures->fftBinsF = fftBins;
+		rhythmFeatures->nFftBins = nFftBins;
+		rhythmFeatures->sequence = sequence++;
+		*isUpdated = true;
+	}
+	return n;
+}
+
+int SoundFeatureEngine::getHop(){
+	return hop;
+}
+
+bool SoundFeatureEngine::isFastUpdated(){
+	return fastUpdated;
+}
+
+bool SoundFeatureEngine::isFastOnset(){
+	return fastUpdated && fastOnsetDetector->isOnset();
+}
+
+uint16_t SoundFeatureEngine::getFastEnergy(){
+	return fastEnergy;
+}
@@ -0,0 +1,38 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SoundUtils.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "SoundUtils.h"
+#include <stdio.h>
+
+#define CLEAN_SCREEN_ANSI "\033[2J\033[H"
+#define FFT_VISUALIZER_SCALE 4		/*one '*' per this much amplitude*/
+
+void visualizeFft(uint8_t* fft, int nFftBins){
+	printf(CLEAN_SCREEN_ANSI);
+	for (int i = 0; i < nFftBins; i++){
+		printf("%3d |", i);
+		for (int j = 0; j < fft[i] / FFT_VISUALIZER_SCALE; j++){
+			putchar('*');
+		}
+		putchar('\n');
+	}
+}
@@ -0,0 +1,133 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SpectralDescriptors.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "SpectralDescriptors.h"
+#include <stddef.h>
+#include <string.h>
+
+SpectralDescriptors::SpectralDescriptors(){
+	nBins = 0;
+	previous = NULL;
+	isFirst = true;
+	dominantBin = 0;
+	centroid = 0;
+	flux = 0;
+	rolloff = 0;
+	dominantBinSum = 0;
+	centroidSum = 0;
+	windowLength = 0;
+	isWindowEnded = false;
+}
+
+SpectralDescriptors::~SpectralDescriptors(){
+	delete [] previous;
+}
+
+void SpectralDescriptors::spectralDescriptorsInit(int _nBins){
+	nBins = _nBins;
+	delete [] previous;
+	previous = new float[nBins > 0 ? nBins : 1];
+	memset(previous, 0, (nBins > 0 ? nBins : 1) * sizeof(float));
+	isFirst = true;
+	dominantBin = 0;
+	centroid = 0;
+	flux = 0;
+	rolloff = 0;
+	dominantBinSum = 0;
+	centroidSum = 0;
+	windowLength = 0;
+	isWindowEnded = false;
+}
+
+/**
+ * the sums are kept free of branches so that they vectorize; the file is built at -O3 for it. Silence leaves
+ * the centroid and the rolloff at 0
+ */
+void SpectralDescriptors::spectralDescriptorsUpdate(const float* bins){
+	float sum = 0;
+	float weighted = 0;
+	float rise = 0;
+	for (int i = 0; i < nBins; i++){
+		float d = bins[i] - previous[i];
+		sum += bins[i];
+		weighted += i * bins[i];
+		rise += (d > 0) ? d : 0;
+	}
+	flux = isFirst ? 0 : rise;
+	isFirst = false;
+	memcpy(previous, bins, nBins * sizeof(float));
+
+	dominantBin = 0;
+	for (int i = 1; i < nBins; i++){
+		if (bins[i] > bins[dominantBin]){
+			dominantBin = i;
+		}
+	}
+	centroid = (sum > 0) ? weighted / sum : 0;
+	rolloff = 0;
+	float below = 0;
+	for (int i = 0; i < nBins && sum > 0; i++){
+		below += bins[i];
+		if (below >= SPECTRAL_ROLLOFF_SHARE * sum){
+			rolloff = i;
+			break;
+		}
+	}
+
+	if (isWindowEnded){
+		dominantBinSum = 0;
+		centroidSum = 0;
+		windowLength = 0;
+		isWindowEnded = false;
+	}
+	dominantBinSum += dominantBin;
+	centroidSum += centroid;
+	windowLength++;
+}
+
+void SpectralDescriptors::endWindow(){
+	isWindowEnded = true;
+}
+
+int SpectralDescriptors::getDominantBin(){
+	return dominantBin;
+}
+
+float SpectralDescriptors::getCentroid(){
+	return centroid;
+}
+
+float SpectralDescriptors::getFlux(){
+	return flux;
+}
+
+float SpectralDescriptors::getRolloff(){
+	return rolloff;
+}
+
+float SpectralDescriptors::getWindowDominantBin(){
+	return (windowLength > 0) ? dominantBinSum / windowLength : 0;
+}
+
+float SpectralDescriptors::getWindowCentroid(){
+	return (windowLength > 0) ? centroidSum / windowLength : 0;
+}
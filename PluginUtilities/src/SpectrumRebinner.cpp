@@ -0,0 +1,114 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SpectrumRebinner.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "SpectrumRebinner.h"
+#include <stddef.h>
+
+SpectrumRebinner::SpectrumRebinner(){
+	maxIn = 0;
+	nIn = 0;
+	generation = 0;
+	prefix = NULL;
+	for (int i = 0; i < SPECTRUM_REBINNER_CACHE_SIZE; i++){
+		cacheCount[i] = 0;
+		cacheGeneration[i] = 0;
+		cacheBins[i] = NULL;
+	}
+	nextEntry = 0;
+}
+
+SpectrumRebinner::~SpectrumRebinner(){
+	delete [] prefix;
+	for (int i = 0; i < SPECTRUM_REBINNER_CACHE_SIZE; i++){
+		delete [] cacheBins[i];
+	}
+}
+
+void SpectrumRebinner::spectrumRebinnerInit(int maxBins){
+	delete [] prefix;
+	maxIn = maxBins;
+	nIn = 0;
+	generation = 0;
+	prefix = new double[maxIn + 1];
+	prefix[0] = 0;
+	for (int i = 0; i < SPECTRUM_REBINNER_CACHE_SIZE; i++){
+		delete [] cacheBins[i];
+		cacheBins[i] = new float[maxIn];
+		cacheCount[i] = 0;
+		cacheGeneration[i] = 0;
+	}
+	nextEntry = 0;
+}
+
+/**
+ * the sums are kept in double, so that the difference of two large sums does not lose the narrow bins
+ */
+void SpectrumRebinner::spectrumRebinnerUpdate(const float* bins, int nBins){
+	nIn = (nBins < maxIn) ? nBins : maxIn;
+	for (int i = 0; i < nIn; i++){
+		prefix[i + 1] = prefix[i] + bins[i];
+	}
+	generation++;
+	if (generation == 0){
+		generation = 1;
+		for (int i = 0; i < SPECTRUM_REBINNER_CACHE_SIZE; i++){
+			cacheGeneration[i] = 0;
+		}
+	}
+}
+
+const float* SpectrumRebinner::getBins(int nOut){
+	if (nOut <= 0 || nOut > maxIn || nIn == 0){
+		return NULL;
+	}
+	int entry = -1;
+	for (int i = 0; i < SPECTRUM_REBINNER_CACHE_SIZE; i++){
+		if (cacheCount[i] == nOut){
+			entry = i;
+		}
+	}
+	if (entry >= 0 && cacheGeneration[entry] == generation){
+		return cacheBins[entry];
+	}
+
+	/*a count seen before keeps its entry, new counts take the entries in turn*/
+	if (entry < 0){
+		entry = nextEntry;
+		nextEntry = (nextEntry + 1) % SPECTRUM_REBINNER_CACHE_SIZE;
+	}
+	float* out = cacheBins[entry];
+	int step = nIn / nOut;
+	if (step >= 1){
+		for (int i = 0; i < nOut; i++){
+			out[i] = (float)((prefix[(i + 1) * step] - prefix[i * step]) / step);
+		}
+	}
+	else {
+		for (int i = 0; i < nOut; i++){
+			int j = (int)((long)i * nIn / nOut);
+			out[i] = (float)(prefix[j + 1] - prefix[j]);
+		}
+	}
+	cacheCount[entry] = nOut;
+	cacheGeneration[entry] = generation;
+	return out;
+}
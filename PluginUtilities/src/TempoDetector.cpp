@@ -0,0 +1,113 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * TempoDetector.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "TempoDetector.h"
+#include "PluginUtilities.h"
+#include <math.h>
+#include <stdio.h>
+
+float getBpmFromInterval(int interval){
+	if (interval <= 0){
+		return 0;
+	}
+	return 60000.0f / (interval * FEATURE_TICK_MS);
+}
+
+TempoDetector::TempoDetector(){
+	autocorrelation = new Histogram(TEMPO_ACF_LAGS);
+	novelty = new Fifo<float>(TEMPO_ACF_LAGS);
+	noveltyMean = 0;
+	float defaultInterval = 60000.0f / (TEMPO_DEFAULT_BPM * FEATURE_TICK_MS);
+	for (int interval = 0; interval <= TEMPO_MAX_INTERVAL; interval++){
+		float octaves = (interval > 0) ? log2f(interval / defaultInterval) / TEMPO_PRIOR_OCTAVES : 0;
+		prior[interval] = expf(-0.5f * octaves * octaves);
+	}
+	onsetInterval = (int)defaultInterval;
+	tempo = TEMPO_DEFAULT_BPM;
+	confidence = 0;
+}
+
+TempoDetector::~TempoDetector(){
+	delete autocorrelation;
+	delete novelty;
+}
+
+/**
+ * the novelty is centred on its running mean, so that steady sound does not correlate at every lag
+ */
+void TempoDetector::updateAutocorrelation(OnsetDetector* onsetDetector){
+	noveltyMean += TEMPO_MEAN_RATE * (onsetDetector->getNovelty() - noveltyMean);
+	float x = onsetDetector->getNovelty() - noveltyMean;
+	novelty->push(x);
+	autocorrelation->degradeHistogram();
+	int n = novelty->getLength();
+	for (int lag = 0; lag < n; lag++){
+		autocorrelation->addToHistogramBin(lag, x * novelty->getElementAtIndex(n - 1 - lag));
+	}
+}
+
+float TempoDetector::getScore(int interval){
+	float energy = autocorrelation->getHistogramBin(0);
+	if (energy <= 0){
+		return 0;
+	}
+	float r = autocorrelation->getHistogramBin(interval) + TEMPO_DOUBLE_WEIGHT * autocorrelation->getHistogramBin(2 * interval);
+	return (r > 0) ? r / energy * prior[interval] : 0;
+}
+
+void TempoDetector::updateTempo(){
+	int best = onsetInterval;
+	for (int interval = TEMPO_MIN_INTERVAL; interval <= TEMPO_MAX_INTERVAL; interval++){
+		if (getScore(interval) > getScore(best)){
+			best = interval;
+		}
+	}
+	if (getScore(best) > TEMPO_SWITCH_RATIO * getScore(onsetInterval)){
+		onsetInterval = best;
+		tempo = getBpmFromInterval(onsetInterval);
+	}
+	float energy = autocorrelation->getHistogramBin(0);
+	float r = (energy > 0) ? autocorrelation->getHistogramBin(onsetInterval) / energy : 0;
+	confidence = (r < 0) ? 0 : (r > 1) ? 1 : r;
+}
+
+void TempoDetector::tempoDetectorTick(OnsetDetector* onsetDetector){
+	updateAutocorrelation(onsetDetector);
+	updateTempo();
+}
+
+int TempoDetector::getOnsetInterval(){
+	return onsetInterval;
+}
+
+float TempoDetector::getTempo(){
+	return tempo;
+}
+
+float TempoDetector::getTempoConfidence(){
+	return confidence;
+}
+
+void TempoDetector::tempoDetectorPrint(int width){
+	printf("tempo %.1f bpm (interval %d)\n", tempo, onsetInterval);
+	autocorrelation->displayHistogram(width);
+}
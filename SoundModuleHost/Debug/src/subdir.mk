@@ -0,0 +1,91 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+CPP_SRCS += \
+../src/AuroraStream.cpp \
+../src/BeatGrid.cpp \
+../../PluginUtilities/src/ColorUtils.cpp \
+../src/FeatureTrace.cpp \
+../../PluginUtilities/src/FixedPoint.cpp \
+../src/HostData.cpp \
+../src/MathBenchmark.cpp \
+../src/OfflineRenderer.cpp \
+../src/PcmSource.cpp \
+../src/PluginLoader.cpp \
+../src/SelfCheck.cpp \
+../src/SoundFeatureReceiver.cpp \
+../src/SoundModuleHost.cpp \
+../../PluginUtilities/src/SpectrumRebinner.cpp 
+
+OBJS += \
+./src/AuroraStream.o \
+./src/BeatGrid.o \
+./src/ColorUtils.o \
+./src/FeatureTrace.o \
+./src/FixedPoint.o \
+./src/HostData.o \
+./src/MathBenchmark.o \
+./src/OfflineRenderer.o \
+./src/PcmSource.o \
+./src/PluginLoader.o \
+./src/SelfCheck.o \
+./src/SoundFeatureReceiver.o \
+./src/SoundModuleHost.o \
+./src/SpectrumRebinner.o 
+
+CPP_DEPS += \
+./src/AuroraStream.d \
+./src/BeatGrid.d \
+./src/ColorUtils.d \
+./src/FeatureTrace.d \
+./src/FixedPoint.d \
+./src/HostData.d \
+./src/MathBenchmark.d \
+./src/OfflineRenderer.d \
+./src/PcmSource.d \
+./src/PluginLoader.d \
+./src/SelfCheck.d \
+./src/SoundFeatureReceiver.d \
+./src/SoundModuleHost.d \
+./src/SpectrumRebinner.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+src/ColorUtils.o: ../../PluginUtilities/src/ColorUtils.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -I../../PluginUtilities/inc -O3 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+src/FixedPoint.o: ../../PluginUtilities/src/FixedPoint.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -I../../PluginUtilities/inc -O0 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+src/MathBenchmark.o: ../src/MathBenchmark.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -I../../PluginUtilities/inc -O3 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+src/SpectrumRebinner.o: ../../PluginUtilities/src/SpectrumRebinner.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -I../../PluginUtilities/inc -O0 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+src/%.o: ../src/%.cpp
+	@echo 'Building file: $<'
+	@echo 'Invoking: Cross G++ Compiler'
+	g++ -I../inc -I../../PluginUtilities/inc -O0 -g3 -Wall -c -fmessage-length=0 -std=c++11 -fPIC -MMD -MP -MF"$(@:%.o=%.d)" -MT"$(@)" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+
@@ -0,0 +1,72 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * AuroraStream.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_AURORASTREAM_H_
+#define INC_AURORASTREAM_H_
+
+#include <netinet/in.h>
+#include <string>
+#include "AuroraPlugin.h"
+
+#define AURORA_API_PORT 16021
+#define AURORA_DEFAULT_STREAM_PORT 60221
+
+/**
+ * Sends frames to an Aurora through its external control (extControl) UDP stream
+ */
+class AuroraStream {
+	AuroraStream(const AuroraStream&) = delete;
+	std::string ip;
+	std::string authToken;
+	int sock;
+	struct sockaddr_in streamAddr;
+	uint8_t packet[1 + 7 * 256];
+public:
+	AuroraStream();
+	~AuroraStream();
+
+	/**
+	 * @description: remember the Aurora to talk to
+	 */
+	void setAurora(const char* ip, const char* authToken);
+
+	/**
+	 * @description: GET an endpoint of the Aurora's v1 API
+	 * @params body: filled with the body of the response
+	 * @return: true on a 2xx response
+	 */
+	bool get(const char* endpoint, std::string* body);
+
+	/**
+	 * @description: put the Aurora into extControl mode and open the stream
+	 */
+	bool open();
+	void close();
+
+	/**
+	 * @description: send one frame of panel colours. Panel ids and colours are truncated to a byte,
+	 * transTime is in multiples of 100ms
+	 */
+	bool sendFrames(const Frame_t* frames, int nFrames);
+};
+
+#endif /* INC_AURORASTREAM_H_ */
@@ -0,0 +1,64 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * BeatGrid.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_BEATGRID_H_
+#define INC_BEATGRID_H_
+
+#include <vector>
+#include "FeatureTrace.h"
+#include "PluginLoader.h"
+
+/**
+ * A beat grid is text: lines starting with '#' are comments, then "tickMs <ms>" and "nTicks <n>", followed
+ * by one line for every tick holding a beat or an onset: "<tick> <isBeat> <isOnset> <tempo> <confidence>".
+ * Ticks that are left out have neither, with the tempo and confidence of the line before them
+ */
+class BeatGrid {
+	BeatGrid(const BeatGrid&) = delete;
+	std::vector<BeatFeatures_t> beats;		/*one per tick*/
+	BeatFeatures_t after;					/*served past the end of the grid*/
+public:
+	BeatGrid();
+	bool load(const char* path);
+	int getLength();
+
+	/**
+	 * @description: the beat features of the tick at the given playback position. Before the grid and past
+	 * its end there are no beats
+	 */
+	const BeatFeatures_t* getBeat(long tick);
+};
+
+/**
+ * @description: analyse the beats of a whole trace or PCM file with the plugin's utilities library
+ * and write them as a beat grid
+ * @params trace: if not NULL, the features to analyse
+ * @params pcmPath: otherwise, mono float32 PCM to compute the features from, a file or - for stdin
+ * @params nThreads: 0 for every core
+ * @return: false if the input could not be read or the grid could not be written
+ */
+bool analyseBeatGrid(PluginLoader* plugin, FeatureTrace* trace, const char* pcmPath, int sampleRate, const char* gridPath,
+		int nThreads);
+
+bool writeBeatGrid(const char* path, const BeatFeatures_t* beats, int nTicks);
+
+#endif /* INC_BEATGRID_H_ */
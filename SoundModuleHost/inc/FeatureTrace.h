@@ -0,0 +1,125 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FeatureTrace.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_FEATURETRACE_H_
+#define INC_FEATURETRACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <vector>
+#include "PluginUtilities.h"
+
+#define FEATURE_TRACE_MAGIC "NLFT"
+#define FEATURE_TRACE_VERSION 1
+#define FEATURE_TRACE_BYTE_ORDER 0x01020304		/*reads back differently if the trace was written on a host of the other endianness*/
+#define FEATURE_TRACE_IS_BEAT 0x01
+#define FEATURE_TRACE_IS_ONSET 0x02
+
+/**
+ * Binary trace layout: a FeatureTraceHeader_t followed by fixed size frames of frameSize bytes,
+ * each a FeatureTraceFrame_t followed by nFftBins bins of binBytes bytes (uint8 or uint16) and padding.
+ * The first frame and every frameSize are multiples of 8 bytes, the alignment of FeatureTraceFrame_t.
+ * All fields are in the byte order of the recording host. A trailing partial frame, e.g. from an interrupted recording, is ignored
+ */
+struct FeatureTraceHeader_t {
+	char magic[4];				/*FEATURE_TRACE_MAGIC*/
+	uint16_t version;			/*FEATURE_TRACE_VERSION*/
+	uint16_t headerSize;		/*offset of the first frame*/
+	uint32_t byteOrder;			/*FEATURE_TRACE_BYTE_ORDER*/
+	uint16_t nFftBins;
+	uint16_t frameSize;
+	uint16_t tickMs;			/*nominal interval between two frames*/
+	uint16_t binBytes;			/*1 or 2*/
+};
+
+struct FeatureTraceFrame_t {
+	uint16_t energy;
+	uint8_t flags;				/*FEATURE_TRACE_IS_BEAT | FEATURE_TRACE_IS_ONSET*/
+	uint8_t confidence;			/*scaled to 255*/
+	float tempo;
+	uint64_t timestamp;			/*capture time of the features, as RhythmFeatures_t*/
+	uint32_t sequence;
+	uint32_t reserved;
+};
+
+/**
+ * A recorded sequence of feature frames, one per FEATURE_TICK_MS.
+ *
+ * Binary traces, as written by FeatureTraceWriter, are memory mapped and their frames are served in place.
+ * Text traces are also accepted: lines starting with '#' are comments, the first line is "nFftBins <n>",
+ * followed by one line per feature frame: "<energy> <isBeat> <isOnset> <tempo> <bin 0> ... <bin n-1>",
+ * with the energy in 0..65535 and the bins in 0..255
+ */
+class FeatureTrace {
+	FeatureTrace(const FeatureTrace&) = delete;
+	uint16_t nFftBins;
+	uint16_t binBytes;
+	uint16_t frameSize;
+	int nFrames;
+	uint8_t* frames;				/*into the mapping, or into textFrames*/
+	void* mapping;
+	size_t mappingSize;
+	std::vector<uint8_t> textFrames;
+	bool loadBinary(const char* path);
+	bool loadText(const char* path);
+public:
+	FeatureTrace();
+	~FeatureTrace();
+	bool load(const char* path);
+	void close();
+	int getLength();
+	uint16_t getNFftBins();
+
+	/**
+	 * @description: get one frame of the trace
+	 * @params rhythmFeatures: filled with the energy, the capture time and sequence number, and the bins,
+	 * either fftBins or fftBins16 depending on the width of the recording. The bins point into the trace,
+	 * which is privately mapped so that they may be written to. Text traces keep no capture times: their
+	 * frames are numbered from 0 and spaced FEATURE_TICK_MS apart
+	 * @params beatFeatures: filled with the recorded beat features
+	 */
+	void getFrame(int index, RhythmFeatures_t* rhythmFeatures, BeatFeatures_t* beatFeatures);
+};
+
+/**
+ * Writes a binary feature trace
+ */
+class FeatureTraceWriter {
+	FeatureTraceWriter(const FeatureTraceWriter&) = delete;
+	FILE* file;
+	uint16_t nFftBins;
+	uint16_t binBytes;
+	std::vector<uint8_t> frame;
+public:
+	FeatureTraceWriter();
+	~FeatureTraceWriter();
+
+	/**
+	 * @params binBytes: 1 to record 8 bit bins, 2 to record 16 bit bins. Bins are widened or saturated as needed
+	 */
+	bool open(const char* path, uint16_t nFftBins, uint16_t binBytes);
+	bool write(const RhythmFeatures_t* rhythmFeatures, const BeatFeatures_t* beatFeatures);
+	void close();
+};
+
+#endif /* INC_FEATURETRACE_H_ */
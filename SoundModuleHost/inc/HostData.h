@@ -0,0 +1,65 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * HostData.h
+ *
+ *  Created on: Oct 15, 2026
+ *
+ *  Readers for the layout, palette and auth token files, producing the streams expected by
+ *  passLayoutData and passColorPalette
+ */
+
+#ifndef INC_HOSTDATA_H_
+#define INC_HOSTDATA_H_
+
+#include <string>
+#include <vector>
+
+/**
+ * @description: parse a layout as returned by the Aurora's panelLayout or panelLayout/layout endpoints,
+ * i.e. JSON with a positionData array of {panelId, x, y, o, shapeType} objects and an optional globalOrientation
+ * @params json: the JSON text
+ * @params layoutStream: filled with the stream for passLayoutData
+ * @params nPanels: filled with the number of panels
+ * @return: false if no panel could be found
+ */
+bool parseLayout(const std::string& json, std::vector<int>* layoutStream, int* nPanels);
+
+/**
+ * @description: read a file holding the layout JSON, see parseLayout
+ */
+bool readLayoutFile(const char* path, std::vector<int>* layoutStream, int* nPanels);
+
+/**
+ * @description: read a palette file as written by the plugin builder tool, i.e.
+ * {"palette": [{"hue": h, "saturation": s, "brightness": b}, ...]}
+ * @params paletteStream: filled with the stream for passColorPalette
+ * @params nColors: filled with the number of colours, may be 0
+ */
+bool readPaletteFile(const char* path, std::vector<int>* paletteStream, int* nColors);
+
+/**
+ * @description: read the auth token saved by the plugin builder tool
+ */
+bool readAuthToken(const char* path, std::string* token);
+
+/**
+ * @description: read a whole file into a string
+ */
+bool readFile(const char* path, std::string* contents);
+
+#endif /* INC_HOSTDATA_H_ */
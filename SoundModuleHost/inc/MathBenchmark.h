@@ -0,0 +1,33 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * MathBenchmark.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_MATHBENCHMARK_H_
+#define INC_MATHBENCHMARK_H_
+
+/**
+ * @description: time the batch forms of FastMath.h against the libm computations they replace, over
+ * MATH_BENCHMARK_SIZE arguments, and lerpRGB8Array of RGB8.h against a float cross fade of as many colours.
+ * Print the nanoseconds per argument and the largest error measured
+ */
+void runMathBenchmark(void);
+
+#endif /* INC_MATHBENCHMARK_H_ */
@@ -0,0 +1,48 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * OfflineRenderer.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_OFFLINERENDERER_H_
+#define INC_OFFLINERENDERER_H_
+
+#include "BeatGrid.h"
+#include "FeatureTrace.h"
+#include "PluginLoader.h"
+
+/**
+ * @description: run the plugin over a recorded trace as fast as possible, one getPluginFrame call per
+ * feature frame, and report the throughput and the latency percentiles of getPluginFrame. The throughput
+ * leaves out the time spent writing the frames file, which is reported end to end on its own
+ * @params plugin: an initialized plugin
+ * @params trace: the features to feed. Its bins are served in place, or rebinned by a SpectrumRebinner
+ * if they do not match what the feature source would send the plugin, see getSourceFftBins
+ * @params framesPath: if not NULL, every call's output is written here as an int32 frame count
+ * followed by that many Frame_t records, in host byte order
+ * @params maxFrames: number of calls to make, wrapping around the trace; 0 for a single pass
+ * @params nPanels: number of panels in the layout
+ * @params grid: if not NULL, its beat features are served in place of those recorded in the trace,
+ * the first tick of the grid with the first call
+ * @return: false if the frames file could not be written
+ */
+bool runOffline(PluginLoader* plugin, FeatureTrace* trace, const char* framesPath, long maxFrames, int nPanels,
+		BeatGrid* grid);
+
+#endif /* INC_OFFLINERENDERER_H_ */
@@ -0,0 +1,54 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * PcmSource.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_PCMSOURCE_H_
+#define INC_PCMSOURCE_H_
+
+#include <stdio.h>
+#include <vector>
+
+/**
+ * Reads mono native endian float32 PCM from a file, from stdin ("-"), or from datagrams sent to a
+ * local UDP port ("udp:<port>"), each datagram holding a whole number of samples
+ */
+class PcmSource {
+	PcmSource(const PcmSource&) = delete;
+	FILE* file;
+	int sock;
+	std::vector<float> datagram;
+	int datagramLength;
+	int datagramIndex;
+public:
+	PcmSource();
+	~PcmSource();
+	bool open(const char* spec);
+	void close();
+
+	/**
+	 * @description: read up to nSamples samples
+	 * @params timeoutMs: how long to wait for a datagram, -1 to block. Files and stdin always block
+	 * @return: number of samples read, 0 on timeout, -1 at the end of the input or on error
+	 */
+	int read(float* samples, int nSamples, int timeoutMs);
+};
+
+#endif /* INC_PCMSOURCE_H_ */
@@ -0,0 +1,78 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * PluginLoader.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_PLUGINLOADER_H_
+#define INC_PLUGINLOADER_H_
+
+#include "AuroraPlugin.h"
+#include "PluginUtilities.h"
+
+/**
+ * Loads a libAuroraPlugin.so and resolves the plugin entry points along with the host facing
+ * functions of the libPluginUtilities it was linked against
+ */
+class PluginLoader {
+	PluginLoader(const PluginLoader&) = delete;
+	void* handle;
+	void* resolve(const char* symbol);
+public:
+	/*plugin*/
+	void (*initPlugin)(void);
+	void (*getPluginFrame)(Frame_t* frames, int* nFrames, int* sleepTime);
+	void (*pluginCleanup)(void);
+
+	/*utilities library*/
+	const char* (*getPluginUtilitiesVersion)(void);
+	void (*passLayoutData)(int* layoutDataByteStream, int nPanels);
+	void (*passColorPalette)(int* colorByteStream, int nColors);
+	void (*dataManagerCleanup)(void);
+	const EnabledFeatures_t* (*getEnabledFeatures)(void);
+	void (*initRhythmFeatures)(void);
+	void (*updateRhythmFeatures)(const RhythmFeatures_t* rhythmFeatures);
+	void (*deinitRhythmFeatures)(void);
+	void (*passRhythmFeatureView)(const RhythmFeatures_t* rhythmFeatures);
+	void (*initBeatFeatures)(void);
+	void (*updateBeatFeatures)(void);
+	void (*deinitBeatFeatures)(void);
+	void (*passBeatFeatures)(const BeatFeatures_t* beatFeatures);
+	const BeatFeatures_t* (*getBeatFeatures)(void);
+	int (*initSoundFeatureEngine)(int sampleRate);
+	int (*processSoundSamples)(const float* samples, int nSamples, bool* isUpdated, RhythmFeatures_t* rhythmFeatures);
+	void (*deinitSoundFeatureEngine)(void);
+	bool (*getIsFastOnset)(void);
+	int (*analyseFeatureBeats)(const uint16_t* energies, const uint8_t* fftBins, int nFftBins, int nTicks,
+			BeatFeatures_t* beats, int nThreads);
+	int (*analysePcmBeats)(const float* samples, long nSamples, int sampleRate, BeatFeatures_t* beats, int maxTicks,
+			int nThreads);
+
+	PluginLoader();
+	~PluginLoader();
+
+	/**
+	 * @description: dlopen the plugin and resolve every entry point
+	 * @return: true on success; on failure the reason has been printed and nothing stays loaded
+	 */
+	bool load(const char* path);
+	void unload();
+};
+
+#endif /* INC_PLUGINLOADER_H_ */
@@ -0,0 +1,33 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SelfCheck.h
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#ifndef INC_SELFCHECK_H_
+#define INC_SELFCHECK_H_
+
+/**
+ * @description: check the kernels of the utilities library that claim to match a reference against it,
+ * over every input or a large sample of them, and print the number of mismatches of each
+ * @return: false if any kernel differs from its reference by more than it is documented to
+ */
+bool runSelfCheck(void);
+
+#endif /* INC_SELFCHECK_H_ */
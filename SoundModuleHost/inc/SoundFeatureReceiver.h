@@ -0,0 +1,110 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SoundFeatureReceiver.h
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#ifndef INC_SOUNDFEATURERECEIVER_H_
+#define INC_SOUNDFEATURERECEIVER_H_
+
+#include <stdint.h>
+#include <sys/types.h>
+#include "PluginUtilities.h"
+
+#define SOUND_FEATURE_HOST "127.0.0.1"
+#define SOUND_FEATURE_PORT 27182			/*music_processor.py sends the features here*/
+#define SOUND_FEATURE_REQUEST_PORT 27184	/*music_processor.py waits for the feature request here*/
+#define MAX_SOUND_FEATURE_PACKET 2048
+#define SOUND_FEATURE_BIN_BYTES 2			/*bin width requested from music_processor.py*/
+#define SOUND_FEATURE_VERSION 2				/*packet version requested from music_processor.py*/
+#define SOUND_FEATURE_MAGIC 0x46534C4E		/*reads "NLSF" from memory on a little endian host*/
+#define SOUND_FEATURE_HAS_ENERGY 0x01
+#define SOUND_FEATURE_HAS_FFT 0x02
+#define SOUND_FEATURE_HAS_BEAT 0x04			/*the beat fields are set, by a source that tracks beats itself*/
+#define SOUND_FEATURE_IS_BEAT 0x01
+#define SOUND_FEATURE_IS_ONSET 0x02
+
+/**
+ * Header of a version 2 feature packet, followed by nFftBins bins of binBytes bytes each at headerSize.
+ * All fields are in the byte order of the sending host, which is the receiving host
+ */
+struct SoundFeaturePacket_t {
+	uint32_t magic;				/*SOUND_FEATURE_MAGIC*/
+	uint8_t version;			/*SOUND_FEATURE_VERSION or later*/
+	uint8_t headerSize;			/*offset of the bins, later versions may append fields to the header*/
+	uint8_t flags;				/*SOUND_FEATURE_HAS_ENERGY | SOUND_FEATURE_HAS_FFT | SOUND_FEATURE_HAS_BEAT*/
+	uint8_t binBytes;			/*1 or 2*/
+	uint16_t nFftBins;
+	uint16_t energy;
+	uint32_t sequence;
+	uint64_t timestamp;			/*capture time in microseconds of the monotonic clock*/
+	float tempo;
+	uint8_t beatFlags;			/*SOUND_FEATURE_IS_BEAT | SOUND_FEATURE_IS_ONSET*/
+	uint8_t confidence;			/*scaled to 255*/
+	uint16_t reserved;
+};
+
+/**
+ * Receives the sound features streamed by music_processor.py. Version 2 packets are read in place through
+ * SoundFeaturePacket_t. Versions of music_processor.py that do not know them send nFftBins uint8 bins followed
+ * by the uint16 energy; those packets are stamped with the time of reception and numbered by the receiver.
+ */
+class SoundFeatureReceiver {
+	SoundFeatureReceiver(const SoundFeatureReceiver&) = delete;
+	int sock;
+	uint16_t nFftBins;
+	alignas(8) uint8_t packet[MAX_SOUND_FEATURE_PACKET];		/*aligned for SoundFeaturePacket_t*/
+	uint32_t sequence;			/*numbers the packets of older versions*/
+	BeatFeatures_t beatFeatures;
+	bool hasBeatFeatures;
+	int receiveVersion2(ssize_t length, RhythmFeatures_t* rhythmFeatures);
+public:
+	SoundFeatureReceiver();
+	~SoundFeatureReceiver();
+
+	/**
+	 * @description: bind the feature port
+	 */
+	bool open(uint16_t port);
+	void close();
+
+	/**
+	 * @description: tell music_processor.py which features to compute, as
+	 * "is_fft n_bins is_energy bin_bytes version". Versions of music_processor.py that do not know the trailing
+	 * fields answer with the uint8 bins they do know, so both are accepted
+	 */
+	bool requestFeatures(const EnabledFeatures_t* enabledFeatures);
+
+	/**
+	 * @description: wait for the next packet
+	 * @params rhythmFeatures: filled on success. fftBins or fftBins16 points into this receiver and stays valid
+	 * until the next call
+	 * @params timeoutMs: how long to wait, 0 to poll, -1 to block
+	 * @return: 1 if a packet was received, 0 on timeout, -1 on error
+	 */
+	int receive(RhythmFeatures_t* rhythmFeatures, int timeoutMs);
+
+	/**
+	 * @description: the beat features of the last packet, if the source sent any
+	 * @return: NULL if it did not
+	 */
+	const BeatFeatures_t* getBeatFeatures();
+};
+
+#endif /* INC_SOUNDFEATURERECEIVER_H_ */
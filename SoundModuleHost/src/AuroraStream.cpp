@@ -0,0 +1,158 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * AuroraStream.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "AuroraStream.h"
+#include <arpa/inet.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define EXT_CONTROL_REQUEST "{\"write\": {\"command\": \"display\", \"animType\": \"extControl\"}}"
+
+/**
+ * a minimal HTTP/1.0 client, enough for the Aurora's REST API
+ */
+static bool httpRequest(const std::string& ip, const char* verb, const std::string& path, const std::string& body,
+		std::string* responseBody){
+	int s = socket(AF_INET, SOCK_STREAM, 0);
+	if (s < 0){
+		perror("Error: could not create http socket");
+		return false;
+	}
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(AURORA_API_PORT);
+	if (inet_pton(AF_INET, ip.c_str(), &addr.sin_addr) != 1 || connect(s, (struct sockaddr*)&addr, sizeof(addr)) < 0){
+		fprintf(stderr, "Error: could not connect to the Aurora at %s\n", ip.c_str());
+		close(s);
+		return false;
+	}
+
+	char header[512];
+	snprintf(header, sizeof(header), "%s %s HTTP/1.0\r\nHost: %s:%d\r\nContent-Type: application/json\r\n"
+			"Content-Length: %d\r\n\r\n", verb, path.c_str(), ip.c_str(), AURORA_API_PORT, (int)body.size());
+	std::string request = std::string(header) + body;
+	if (send(s, request.c_str(), request.size(), 0) != (ssize_t)request.size()){
+		perror("Error: could not send http request");
+		close(s);
+		return false;
+	}
+
+	std::string response;
+	char buf[1024];
+	ssize_t n;
+	while ((n = recv(s, buf, sizeof(buf), 0)) > 0){
+		response.append(buf, n);
+	}
+	close(s);
+
+	int status = 0;
+	sscanf(response.c_str(), "HTTP/%*s %d", &status);
+	size_t bodyStart = response.find("\r\n\r\n");
+	*responseBody = (bodyStart == std::string::npos) ? "" : response.substr(bodyStart + 4);
+	if (status < 200 || status >= 300){
+		fprintf(stderr, "Error: %s %s returned %d\n", verb, path.c_str(), status);
+		return false;
+	}
+	return true;
+}
+
+static uint8_t toByte(int v){
+	return (v < 0) ? 0 : ((v > 255) ? 255 : v);
+}
+
+AuroraStream::AuroraStream(){
+	sock = -1;
+	memset(&streamAddr, 0, sizeof(streamAddr));
+}
+
+AuroraStream::~AuroraStream(){
+	close();
+}
+
+void AuroraStream::setAurora(const char* _ip, const char* _authToken){
+	ip = _ip;
+	authToken = _authToken;
+}
+
+bool AuroraStream::get(const char* endpoint, std::string* body){
+	return httpRequest(ip, "GET", "/api/v1/" + authToken + "/" + endpoint, "", body);
+}
+
+bool AuroraStream::open(){
+	close();
+	std::string response;
+	if (!httpRequest(ip, "PUT", "/api/v1/" + authToken + "/effects", EXT_CONTROL_REQUEST, &response)){
+		return false;
+	}
+
+	int port = AURORA_DEFAULT_STREAM_PORT;
+	size_t pos = response.find("\"streamControlPort\"");
+	if (pos != std::string::npos && (pos = response.find(':', pos)) != std::string::npos){
+		port = atoi(response.c_str() + pos + 1);
+	}
+
+	sock = socket(AF_INET, SOCK_DGRAM, 0);
+	if (sock < 0){
+		perror("Error: could not create stream socket");
+		return false;
+	}
+	streamAddr.sin_family = AF_INET;
+	streamAddr.sin_port = htons(port);
+	inet_pton(AF_INET, ip.c_str(), &streamAddr.sin_addr);
+	return true;
+}
+
+void AuroraStream::close(){
+	if (sock >= 0){
+		::close(sock);
+		sock = -1;
+	}
+}
+
+/**
+ * extControl v1 packet: nPanels, then per panel: panelId, nFrames (always 1), R, G, B, W, transTime.
+ * Colours are clamped to [0, 255].
+ */
+bool AuroraStream::sendFrames(const Frame_t* frames, int nFrames){
+	if (sock < 0){
+		return false;
+	}
+	if (nFrames > 255){
+		nFrames = 255;
+	}
+	uint8_t* p = packet;
+	*p++ = nFrames;
+	for (int i = 0; i < nFrames; i++){
+		*p++ = frames[i].panelId;
+		*p++ = 1;
+		*p++ = toByte(frames[i].r);
+		*p++ = toByte(frames[i].g);
+		*p++ = toByte(frames[i].b);
+		*p++ = 0;
+		*p++ = toByte(frames[i].transTime);
+	}
+	return sendto(sock, packet, p - packet, 0, (struct sockaddr*)&streamAddr, sizeof(streamAddr)) == p - packet;
+}
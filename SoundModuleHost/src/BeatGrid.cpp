@@ -0,0 +1,208 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * BeatGrid.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "BeatGrid.h"
+#include "PcmSource.h"
+#include <chrono>
+#include <stdio.h>
+#include <string.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define PCM_READ_SAMPLES 65536
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * the beat engine takes 8 bit bins, wider bins are saturated
+ */
+static int analyseTrace(PluginLoader* plugin, FeatureTrace* trace, std::vector<BeatFeatures_t>* beats, int nThreads){
+	int nTicks = trace->getLength();
+	int nFftBins = trace->getNFftBins();
+	std::vector<uint16_t> energies(nTicks);
+	std::vector<uint8_t> bins((size_t)nTicks * nFftBins);
+	for (int i = 0; i < nTicks; i++){
+		RhythmFeatures_t rhythmFeatures;
+		BeatFeatures_t recorded;
+		trace->getFrame(i, &rhythmFeatures, &recorded);
+		energies[i] = rhythmFeatures.energy;
+		uint8_t* out = bins.data() + (size_t)i * nFftBins;
+		for (int j = 0; j < nFftBins; j++){
+			if (rhythmFeatures.fftBins16){
+				out[j] = (rhythmFeatures.fftBins16[j] > 255) ? 255 : rhythmFeatures.fftBins16[j];
+			}
+			else {
+				out[j] = rhythmFeatures.fftBins[j];
+			}
+		}
+	}
+	beats->resize(nTicks);
+	return plugin->analyseFeatureBeats(energies.data(), bins.data(), nFftBins, nTicks, beats->data(), nThreads);
+}
+
+static int analysePcm(PluginLoader* plugin, const char* pcmPath, int sampleRate, std::vector<BeatFeatures_t>* beats,
+		int nThreads){
+	PcmSource pcm;
+	if (!pcm.open(pcmPath)){
+		return -1;
+	}
+	std::vector<float> samples;
+	int n;
+	do {
+		size_t length = samples.size();
+		samples.resize(length + PCM_READ_SAMPLES);
+		n = pcm.read(samples.data() + length, PCM_READ_SAMPLES, -1);
+		samples.resize(length + (n > 0 ? n : 0));
+	} while (n >= 0);
+
+	int nTicks = plugin->analysePcmBeats(samples.data(), samples.size(), sampleRate, NULL, 0, nThreads);
+	beats->resize(nTicks);
+	return plugin->analysePcmBeats(samples.data(), samples.size(), sampleRate, beats->data(), nTicks, nThreads);
+}
+
+bool analyseBeatGrid(PluginLoader* plugin, FeatureTrace* trace, const char* pcmPath, int sampleRate, const char* gridPath,
+		int nThreads){
+	std::vector<BeatFeatures_t> beats;
+	Clock::time_point begin = Clock::now();
+	int nTicks = trace ? analyseTrace(plugin, trace, &beats, nThreads) : analysePcm(plugin, pcmPath, sampleRate, &beats, nThreads);
+	double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+	if (nTicks < 0){
+		return false;
+	}
+
+	int nBeats = 0;
+	for (int i = 0; i < nTicks; i++){
+		nBeats += beats[i].isBeat;
+	}
+	double trackSeconds = nTicks * FEATURE_TICK_MS / 1000.0;
+	printf("beat analysis: %d beats in %.1f s of features, analysed in %.3f s, %.0fx real time on %d threads\n",
+			nBeats, trackSeconds, seconds, trackSeconds / seconds,
+			(nThreads > 0) ? nThreads : (int)std::thread::hardware_concurrency());
+	return writeBeatGrid(gridPath, beats.data(), nTicks);
+}
+
+BeatGrid::BeatGrid(){
+}
+
+bool BeatGrid::load(const char* path){
+	beats.clear();
+	after = BeatFeatures_t();
+	std::ifstream file(path);
+	if (!file){
+		fprintf(stderr, "Error: could not open beat grid %s\n", path);
+		return false;
+	}
+
+	std::string line;
+	int tickMs = -1;
+	int nTicks = -1;
+	int lineNumber = 0;
+	int previous = -1;
+	BeatFeatures_t held;
+	while (std::getline(file, line)){
+		lineNumber++;
+		if (line.empty() || line[0] == '#'){
+			continue;
+		}
+		std::istringstream ss(line);
+		if (tickMs < 0 || nTicks < 0){
+			std::string key;
+			int value = -1;
+			ss >> key >> value;
+			if (key == "tickMs" && value > 0){
+				tickMs = value;
+			}
+			else if (key == "nTicks" && value >= 0){
+				nTicks = value;
+				beats.reserve(nTicks);
+			}
+			else {
+				fprintf(stderr, "Error: %s:%d: expected \"tickMs <ms>\" and \"nTicks <n>\"\n", path, lineNumber);
+				return false;
+			}
+			if (tickMs > 0 && tickMs != FEATURE_TICK_MS){
+				fprintf(stderr, "Error: beat grid %s has ticks of %d ms, expected %d\n", path, tickMs, FEATURE_TICK_MS);
+				return false;
+			}
+			continue;
+		}
+
+		int tick, isBeat, isOnset;
+		BeatFeatures_t beat;
+		ss >> tick >> isBeat >> isOnset >> beat.tempo >> beat.confidence;
+		if (ss.fail() || tick <= previous || tick >= nTicks){
+			fprintf(stderr, "Error: %s:%d: malformed beat\n", path, lineNumber);
+			beats.clear();
+			return false;
+		}
+		beats.resize(tick, held);
+		held.tempo = beat.tempo;
+		held.confidence = beat.confidence;
+		beat.isBeat = isBeat != 0;
+		beat.isOnset = isOnset != 0;
+		beats.push_back(beat);
+		previous = tick;
+	}
+	if (nTicks < 0){
+		fprintf(stderr, "Error: beat grid %s is empty\n", path);
+		return false;
+	}
+	beats.resize(nTicks, held);
+	after.tempo = held.tempo;
+	return true;
+}
+
+int BeatGrid::getLength(){
+	return beats.size();
+}
+
+const BeatFeatures_t* BeatGrid::getBeat(long tick){
+	if (tick < 0 || tick >= (long)beats.size()){
+		return &after;
+	}
+	return &beats[tick];
+}
+
+bool writeBeatGrid(const char* path, const BeatFeatures_t* beats, int nTicks){
+	FILE* file = fopen(path, "w");
+	if (file == NULL){
+		perror("Error: could not write the beat grid");
+		return false;
+	}
+	fprintf(file, "# beat grid: <tick> <isBeat> <isOnset> <tempo> <confidence>, for the ticks with a beat or an onset\n");
+	fprintf(file, "tickMs %d\n", FEATURE_TICK_MS);
+	fprintf(file, "nTicks %d\n", nTicks);
+	for (int i = 0; i < nTicks; i++){
+		if (beats[i].isBeat || beats[i].isOnset){
+			fprintf(file, "%d %d %d %.2f %.3f\n", i, beats[i].isBeat, beats[i].isOnset, beats[i].tempo, beats[i].confidence);
+		}
+	}
+	bool ok = !ferror(file);
+	if (fclose(file) != 0 || !ok){
+		perror("Error: could not write the beat grid");
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,320 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * FeatureTrace.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "FeatureTrace.h"
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+/**
+ * frames stay 8 byte aligned for their FeatureTraceFrame_t
+ */
+static uint16_t getFrameSize(uint16_t nFftBins, uint16_t binBytes){
+	return (sizeof(FeatureTraceFrame_t) + nFftBins * binBytes + 7) & ~7;
+}
+
+static uint16_t getHeaderSize(void){
+	return (sizeof(FeatureTraceHeader_t) + 7) & ~7;
+}
+
+FeatureTrace::FeatureTrace(){
+	nFftBins = 0;
+	binBytes = 1;
+	frameSize = 0;
+	nFrames = 0;
+	frames = NULL;
+	mapping = NULL;
+	mappingSize = 0;
+}
+
+FeatureTrace::~FeatureTrace(){
+	close();
+}
+
+bool FeatureTrace::load(const char* path){
+	close();
+	FILE* file = fopen(path, "rb");
+	if (file == NULL){
+		fprintf(stderr, "Error: could not open trace %s\n", path);
+		return false;
+	}
+	char magic[4] = {0};
+	size_t length = fread(magic, 1, sizeof(magic), file);
+	fclose(file);
+
+	bool ok;
+	if (length == sizeof(magic) && memcmp(magic, FEATURE_TRACE_MAGIC, sizeof(magic)) == 0){
+		ok = loadBinary(path);
+	}
+	else {
+		ok = loadText(path);
+	}
+	if (ok && nFrames == 0){
+		fprintf(stderr, "Error: trace %s holds no feature frames\n", path);
+		ok = false;
+	}
+	if (!ok){
+		close();
+	}
+	return ok;
+}
+
+bool FeatureTrace::loadBinary(const char* path){
+	int fd = open(path, O_RDONLY);
+	struct stat st;
+	if (fd < 0 || fstat(fd, &st) < 0){
+		perror("Error: could not open trace");
+		if (fd >= 0){
+			::close(fd);
+		}
+		return false;
+	}
+	if ((size_t)st.st_size < sizeof(FeatureTraceHeader_t)){
+		fprintf(stderr, "Error: trace %s is truncated\n", path);
+		::close(fd);
+		return false;
+	}
+	/*private and writable: plugins may write to the bins served from the mapping*/
+	mappingSize = st.st_size;
+	mapping = mmap(NULL, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED){
+		perror("Error: could not map trace");
+		mapping = NULL;
+		return false;
+	}
+
+	const FeatureTraceHeader_t* header = (const FeatureTraceHeader_t*)mapping;
+	if (header->version != FEATURE_TRACE_VERSION){
+		fprintf(stderr, "Error: trace %s has version %d, expected %d\n", path, header->version, FEATURE_TRACE_VERSION);
+		return false;
+	}
+	if (header->byteOrder != FEATURE_TRACE_BYTE_ORDER){
+		fprintf(stderr, "Error: trace %s was recorded with the other byte order\n", path);
+		return false;
+	}
+	if (header->nFftBins > MAX_FFT_BINS || (header->binBytes != 1 && header->binBytes != 2) ||
+			header->frameSize < getFrameSize(header->nFftBins, header->binBytes) ||
+			header->headerSize < sizeof(FeatureTraceHeader_t) || header->headerSize > mappingSize ||
+			header->headerSize % 8 != 0 || header->frameSize % 8 != 0){
+		fprintf(stderr, "Error: trace %s has a malformed header\n", path);
+		return false;
+	}
+	nFftBins = header->nFftBins;
+	binBytes = header->binBytes;
+	frameSize = header->frameSize;
+	nFrames = (mappingSize - header->headerSize) / frameSize;
+	frames = (uint8_t*)mapping + header->headerSize;
+	return true;
+}
+
+/**
+ * parse the text frames into the binary frame layout, so that both are served alike
+ */
+bool FeatureTrace::loadText(const char* path){
+	std::ifstream file(path);
+	if (!file){
+		fprintf(stderr, "Error: could not open trace %s\n", path);
+		return false;
+	}
+
+	std::string line;
+	bool haveHeader = false;
+	int lineNumber = 0;
+	while (std::getline(file, line)){
+		lineNumber++;
+		if (line.empty() || line[0] == '#'){
+			continue;
+		}
+		std::istringstream ss(line);
+		if (!haveHeader){
+			std::string key;
+			int n = -1;
+			ss >> key >> n;
+			if (key != "nFftBins" || n < 0 || n > MAX_FFT_BINS){
+				fprintf(stderr, "Error: %s:%d: expected \"nFftBins <n>\"\n", path, lineNumber);
+				return false;
+			}
+			nFftBins = n;
+			binBytes = 1;
+			frameSize = getFrameSize(nFftBins, binBytes);
+			haveHeader = true;
+			continue;
+		}
+
+		textFrames.resize(textFrames.size() + frameSize);
+		uint8_t* frame = textFrames.data() + textFrames.size() - frameSize;
+		uint8_t* bins = frame + sizeof(FeatureTraceFrame_t);
+		int energy, isBeat, isOnset;
+		float tempo;
+		ss >> energy >> isBeat >> isOnset >> tempo;
+		bool inRange = energy >= 0 && energy <= UINT16_MAX;
+		for (int i = 0; i < nFftBins; i++){
+			int bin;
+			ss >> bin;
+			inRange = inRange && bin >= 0 && bin <= UINT8_MAX;
+			bins[i] = bin;
+		}
+		if (ss.fail() || !inRange){
+			fprintf(stderr, "Error: %s:%d: malformed feature frame\n", path, lineNumber);
+			return false;
+		}
+		FeatureTraceFrame_t* header = (FeatureTraceFrame_t*)frame;
+		header->energy = energy;
+		header->flags = (isBeat ? FEATURE_TRACE_IS_BEAT : 0) | (isOnset ? FEATURE_TRACE_IS_ONSET : 0);
+		header->tempo = tempo;
+		header->timestamp = (uint64_t)nFrames * FEATURE_TICK_MS * 1000;
+		header->sequence = nFrames;
+		nFrames++;
+	}
+	frames = textFrames.data();
+	return true;
+}
+
+void FeatureTrace::close(){
+	if (mapping){
+		munmap(mapping, mappingSize);
+		mapping = NULL;
+	}
+	mappingSize = 0;
+	textFrames.clear();
+	frames = NULL;
+	nFrames = 0;
+	nFftBins = 0;
+	binBytes = 1;
+	frameSize = 0;
+}
+
+int FeatureTrace::getLength(){
+	return nFrames;
+}
+
+uint16_t FeatureTrace::getNFftBins(){
+	return nFftBins;
+}
+
+void FeatureTrace::getFrame(int index, RhythmFeatures_t* rhythmFeatures, BeatFeatures_t* beatFeatures){
+	uint8_t* frame = frames + (size_t)index * frameSize;
+	const FeatureTraceFrame_t* header = (const FeatureTraceFrame_t*)frame;
+	rhythmFeatures->energy = header->energy;
+	rhythmFeatures->timestamp = header->timestamp;
+	rhythmFeatures->sequence = header->sequence;
+	uint8_t* bins = frame + sizeof(FeatureTraceFrame_t);
+	rhythmFeatures->fftBins = (binBytes == 1) ? bins : NULL;
+	rhythmFeatures->fftBins16 = (binBytes == 2) ? (const uint16_t*)bins : NULL;
+	rhythmFeatures->nFftBins = nFftBins;
+	beatFeatures->isBeat = (header->flags & FEATURE_TRACE_IS_BEAT) != 0;
+	beatFeatures->isOnset = (header->flags & FEATURE_TRACE_IS_ONSET) != 0;
+	beatFeatures->tempo = header->tempo;
+	beatFeatures->confidence = header->confidence / 255.0f;
+}
+
+FeatureTraceWriter::FeatureTraceWriter(){
+	file = NULL;
+	nFftBins = 0;
+	binBytes = 1;
+}
+
+FeatureTraceWriter::~FeatureTraceWriter(){
+	close();
+}
+
+bool FeatureTraceWriter::open(const char* path, uint16_t _nFftBins, uint16_t _binBytes){
+	close();
+	nFftBins = _nFftBins;
+	binBytes = _binBytes;
+	frame.assign(getFrameSize(nFftBins, binBytes), 0);
+
+	/*padded so that the first frame is 8 byte aligned*/
+	std::vector<uint8_t> padded(getHeaderSize(), 0);
+	FeatureTraceHeader_t header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, FEATURE_TRACE_MAGIC, sizeof(header.magic));
+	header.version = FEATURE_TRACE_VERSION;
+	header.headerSize = padded.size();
+	header.byteOrder = FEATURE_TRACE_BYTE_ORDER;
+	header.nFftBins = nFftBins;
+	header.frameSize = frame.size();
+	header.tickMs = FEATURE_TICK_MS;
+	header.binBytes = binBytes;
+	memcpy(padded.data(), &header, sizeof(header));
+
+	file = fopen(path, "wb");
+	if (file == NULL || fwrite(padded.data(), padded.size(), 1, file) != 1){
+		perror("Error: could not write trace");
+		close();
+		return false;
+	}
+	return true;
+}
+
+bool FeatureTraceWriter::write(const RhythmFeatures_t* rhythmFeatures, const BeatFeatures_t* beatFeatures){
+	if (file == NULL){
+		return false;
+	}
+	FeatureTraceFrame_t* header = (FeatureTraceFrame_t*)frame.data();
+	uint8_t* bins = frame.data() + sizeof(FeatureTraceFrame_t);
+	header->energy = rhythmFeatures->energy;
+	header->flags = (beatFeatures->isBeat ? FEATURE_TRACE_IS_BEAT : 0) | (beatFeatures->isOnset ? FEATURE_TRACE_IS_ONSET : 0);
+	header->tempo = beatFeatures->tempo;
+	header->confidence = (uint8_t)(beatFeatures->confidence * 255 + 0.5f);
+	header->timestamp = rhythmFeatures->timestamp;
+	header->sequence = rhythmFeatures->sequence;
+	memset(bins, 0, frame.size() - sizeof(FeatureTraceFrame_t));
+	int n = (rhythmFeatures->nFftBins < nFftBins) ? rhythmFeatures->nFftBins : nFftBins;
+	for (int i = 0; i < n; i++){
+		uint16_t bin = 0;
+		if (rhythmFeatures->fftBinsF){
+			float f = rhythmFeatures->fftBinsF[i];
+			bin = (f > UINT16_MAX) ? UINT16_MAX : (uint16_t)f;
+		}
+		else if (rhythmFeatures->fftBins16){
+			bin = rhythmFeatures->fftBins16[i];
+		}
+		else if (rhythmFeatures->fftBins){
+			bin = rhythmFeatures->fftBins[i];
+		}
+		if (binBytes == 2){
+			memcpy(bins + i * sizeof(uint16_t), &bin, sizeof(uint16_t));
+		}
+		else {
+			bins[i] = (bin > 255) ? 255 : bin;
+		}
+	}
+	if (fwrite(frame.data(), frame.size(), 1, file) != 1){
+		perror("Error: could not write trace");
+		return false;
+	}
+	return true;
+}
+
+void FeatureTraceWriter::close(){
+	if (file){
+		fclose(file);
+		file = NULL;
+	}
+}
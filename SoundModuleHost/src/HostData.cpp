@@ -0,0 +1,167 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * HostData.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "HostData.h"
+#include "PluginUtilities.h"
+#include "Shape.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <fstream>
+#include <sstream>
+
+/**
+ * find "key" at or after pos and parse the number following its colon.
+ * The files we read are flat enough that scanning for keys is all the JSON support we need.
+ * @return: the position just past the number, or std::string::npos if the key is not there
+ */
+static size_t findNumber(const std::string& json, const char* key, size_t pos, double* value){
+	std::string quoted = std::string("\"") + key + "\"";
+	pos = json.find(quoted, pos);
+	if (pos == std::string::npos){
+		return pos;
+	}
+	pos = json.find(':', pos + quoted.size());
+	if (pos == std::string::npos){
+		return pos;
+	}
+	const char* start = json.c_str() + pos + 1;
+	char* end;
+	*value = strtod(start, &end);
+	if (end == start){
+		return std::string::npos;
+	}
+	return end - json.c_str();
+}
+
+/**
+ * split the array stored under "key" into its (flat) objects
+ */
+static std::vector<std::string> getObjectsOfArray(const std::string& json, const char* key){
+	std::vector<std::string> objects;
+	size_t pos = json.find(std::string("\"") + key + "\"");
+	if (pos == std::string::npos){
+		return objects;
+	}
+	pos = json.find('[', pos);
+	size_t arrayEnd = json.find(']', pos);
+	while (pos != std::string::npos){
+		size_t open = json.find('{', pos);
+		if (open == std::string::npos || open > arrayEnd){
+			break;
+		}
+		size_t close = json.find('}', open);
+		if (close == std::string::npos){
+			break;
+		}
+		objects.push_back(json.substr(open, close - open + 1));
+		pos = close;
+	}
+	return objects;
+}
+
+bool readFile(const char* path, std::string* contents){
+	std::ifstream file(path);
+	if (!file){
+		fprintf(stderr, "Error: could not open %s\n", path);
+		return false;
+	}
+	std::stringstream ss;
+	ss << file.rdbuf();
+	*contents = ss.str();
+	return true;
+}
+
+bool parseLayout(const std::string& json, std::vector<int>* layoutStream, int* nPanels){
+	layoutStream->clear();
+	*nPanels = 0;
+
+	double globalOrientation = 0;
+	size_t pos = json.find("\"globalOrientation\"");
+	if (pos != std::string::npos){
+		findNumber(json, "value", pos, &globalOrientation);
+	}
+	layoutStream->push_back((int)globalOrientation);
+
+	std::vector<std::string> panels = getObjectsOfArray(json, "positionData");
+	for (size_t i = 0; i < panels.size(); i++){
+		double id, x, y, o;
+		double shapeType = SHAPE_TRIANGLE;
+		const std::string& panel = panels[i];
+		if (findNumber(panel, "panelId", 0, &id) == std::string::npos || findNumber(panel, "x", 0, &x) == std::string::npos ||
+				findNumber(panel, "y", 0, &y) == std::string::npos || findNumber(panel, "o", 0, &o) == std::string::npos){
+			fprintf(stderr, "Error: incomplete layout entry %s\n", panel.c_str());
+			return false;
+		}
+		findNumber(panel, "shapeType", 0, &shapeType);
+		int stream[LAYOUT_INTS_PER_PANEL] = {(int)id, (int)x, (int)y, (int)o, (int)shapeType};
+		layoutStream->insert(layoutStream->end(), stream, stream + LAYOUT_INTS_PER_PANEL);
+		(*nPanels)++;
+	}
+	return *nPanels > 0;
+}
+
+bool readLayoutFile(const char* path, std::vector<int>* layoutStream, int* nPanels){
+	std::string json;
+	if (!readFile(path, &json)){
+		return false;
+	}
+	if (!parseLayout(json, layoutStream, nPanels)){
+		fprintf(stderr, "Error: no panels found in %s\n", path);
+		return false;
+	}
+	return true;
+}
+
+bool readPaletteFile(const char* path, std::vector<int>* paletteStream, int* nColors){
+	std::string json;
+	paletteStream->clear();
+	*nColors = 0;
+	if (!readFile(path, &json)){
+		return false;
+	}
+
+	std::vector<std::string> colors = getObjectsOfArray(json, "palette");
+	for (size_t i = 0; i < colors.size(); i++){
+		double h, s, b;
+		const std::string& color = colors[i];
+		if (findNumber(color, "hue", 0, &h) == std::string::npos || findNumber(color, "saturation", 0, &s) == std::string::npos ||
+				findNumber(color, "brightness", 0, &b) == std::string::npos){
+			fprintf(stderr, "Error: incomplete colour %s in %s\n", color.c_str(), path);
+			return false;
+		}
+		int stream[PALETTE_INTS_PER_COLOR] = {(int)h, (int)s, (int)b};
+		paletteStream->insert(paletteStream->end(), stream, stream + PALETTE_INTS_PER_COLOR);
+		(*nColors)++;
+	}
+	return true;
+}
+
+bool readAuthToken(const char* path, std::string* token){
+	if (!readFile(path, token)){
+		return false;
+	}
+	size_t end = token->find_first_of(" \t\r\n");
+	if (end != std::string::npos){
+		token->erase(end);
+	}
+	return !token->empty();
+}
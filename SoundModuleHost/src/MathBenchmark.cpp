@@ -0,0 +1,198 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * MathBenchmark.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "MathBenchmark.h"
+#include "FastMath.h"
+#include "RGB8.h"
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#define MATH_BENCHMARK_SIZE 4096			/*arguments per pass, small enough to stay in cache*/
+#define MATH_BENCHMARK_PASSES 2000
+#define MATH_BENCHMARK_FALLOFF_K 0.008f		/*EnergyDrum's falloff with distance*/
+#define MATH_BENCHMARK_BLEND_WEIGHT 96		/*of the second frame in a cross fade, out of 255*/
+
+typedef std::chrono::steady_clock Clock;
+typedef void (*BenchmarkKernel)(const float* x, const float* y, float* out, int n);
+typedef void (*BlendKernel)(const RGB8_t* from, const RGB8_t* to, RGB8_t* out, int n);
+
+static void libmRsqrt(const float* x, const float*, float* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = 1.0f / sqrtf(x[i]);
+	}
+}
+
+static void fastRsqrtKernel(const float* x, const float*, float* out, int n){
+	fastRsqrtBatch(x, out, n);
+}
+
+static void libmDistance(const float* x, const float* y, float* out, int n){
+	for (int i = 0; i < n; i++){
+		float dx = x[i] - 1.0f;
+		float dy = y[i] - 2.0f;
+		out[i] = sqrtf(dx * dx + dy * dy);
+	}
+}
+
+static void fastDistanceKernel(const float* x, const float* y, float* out, int n){
+	fastDistanceBatch(1.0f, 2.0f, x, y, out, n);
+}
+
+static void libmLog2(const float* x, const float*, float* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = log2f(x[i]);
+	}
+}
+
+static void fastLog2Kernel(const float* x, const float*, float* out, int n){
+	fastLog2Batch(x, out, n);
+}
+
+static void libmFalloff(const float* x, const float*, float* out, int n){
+	for (int i = 0; i < n; i++){
+		out[i] = 1.0f / (MATH_BENCHMARK_FALLOFF_K * x[i] + 1.0f);
+	}
+}
+
+static void fastFalloffKernel(const float* x, const float*, float* out, int n){
+	fastFalloffBatch(x, MATH_BENCHMARK_FALLOFF_K, out, n);
+}
+
+/**
+ * a cross fade as plugins write it, one colour at a time in floats
+ */
+static void floatBlend(const RGB8_t* from, const RGB8_t* to, RGB8_t* out, int n){
+	const float t = MATH_BENCHMARK_BLEND_WEIGHT / 255.0f;
+	for (int i = 0; i < n; i++){
+		out[i].R = (uint8_t)(from[i].R * (1.0f - t) + to[i].R * t + 0.5f);
+		out[i].G = (uint8_t)(from[i].G * (1.0f - t) + to[i].G * t + 0.5f);
+		out[i].B = (uint8_t)(from[i].B * (1.0f - t) + to[i].B * t + 0.5f);
+		out[i].A = (uint8_t)(from[i].A * (1.0f - t) + to[i].A * t + 0.5f);
+	}
+}
+
+static void rgb8BlendKernel(const RGB8_t* from, const RGB8_t* to, RGB8_t* out, int n){
+	lerpRGB8Array(from, to, MATH_BENCHMARK_BLEND_WEIGHT, out, n);
+}
+
+/**
+ * nanoseconds per argument of the kernel over every pass
+ */
+static double timeKernel(BenchmarkKernel kernel, const std::vector<float>& x, const std::vector<float>& y,
+		std::vector<float>* out){
+	/*called through a volatile pointer, so that passes cannot be merged or dropped*/
+	BenchmarkKernel volatile call = kernel;
+	Clock::time_point start = Clock::now();
+	for (int pass = 0; pass < MATH_BENCHMARK_PASSES; pass++){
+		call(x.data(), y.data(), out->data(), x.size());
+	}
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	return seconds * 1e9 / ((double)MATH_BENCHMARK_PASSES * x.size());
+}
+
+static void compareKernels(const char* name, BenchmarkKernel reference, BenchmarkKernel fast, bool isRelative,
+		const std::vector<float>& x, const std::vector<float>& y){
+	std::vector<float> expected(x.size());
+	std::vector<float> actual(x.size());
+	double libmNs = timeKernel(reference, x, y, &expected);
+	double fastNs = timeKernel(fast, x, y, &actual);
+	double maxError = 0;
+	for (size_t i = 0; i < x.size(); i++){
+		double error = fabs((double)actual[i] - expected[i]);
+		if (isRelative && expected[i] != 0){
+			error /= fabs(expected[i]);
+		}
+		if (error > maxError){
+			maxError = error;
+		}
+	}
+	printf("%-10s libm %6.2f ns  fast %6.2f ns  x%5.2f  max %s error %.2e\n", name, libmNs, fastNs,
+			libmNs / fastNs, isRelative ? "relative" : "absolute", maxError);
+}
+
+/**
+ * nanoseconds per colour of the blend over every pass
+ */
+static double timeBlend(BlendKernel kernel, const std::vector<RGB8_t>& from, const std::vector<RGB8_t>& to,
+		std::vector<RGB8_t>* out){
+	BlendKernel volatile call = kernel;
+	Clock::time_point start = Clock::now();
+	for (int pass = 0; pass < MATH_BENCHMARK_PASSES; pass++){
+		call(from.data(), to.data(), out->data(), from.size());
+	}
+	double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+	return seconds * 1e9 / ((double)MATH_BENCHMARK_PASSES * from.size());
+}
+
+static void compareBlends(const char* name, BlendKernel reference, BlendKernel fast,
+		const std::vector<RGB8_t>& from, const std::vector<RGB8_t>& to){
+	std::vector<RGB8_t> expected(from.size());
+	std::vector<RGB8_t> actual(from.size());
+	double floatNs = timeBlend(reference, from, to, &expected);
+	double fastNs = timeBlend(fast, from, to, &actual);
+	int maxError = 0;
+	for (size_t i = 0; i < from.size(); i++){
+		const uint8_t* a = &actual[i].R;
+		const uint8_t* e = &expected[i].R;
+		for (int c = 0; c < 4; c++){
+			int error = abs((int)a[c] - (int)e[c]);
+			if (error > maxError){
+				maxError = error;
+			}
+		}
+	}
+	printf("%-10s float %6.2f ns  rgb8 %6.2f ns  x%5.2f  max absolute error %d\n", name, floatNs, fastNs,
+			floatNs / fastNs, maxError);
+}
+
+void runMathBenchmark(void){
+	/*arguments spread over several decades, as powers, distances and coordinates are*/
+	std::vector<float> x(MATH_BENCHMARK_SIZE);
+	std::vector<float> px(MATH_BENCHMARK_SIZE);
+	std::vector<float> py(MATH_BENCHMARK_SIZE);
+	std::vector<RGB8_t> frame(MATH_BENCHMARK_SIZE);
+	std::vector<RGB8_t> nextFrame(MATH_BENCHMARK_SIZE);
+	uint32_t seed = 1;
+	for (int i = 0; i < MATH_BENCHMARK_SIZE; i++){
+		seed = seed * 1664525 + 1013904223;
+		x[i] = powf(10.0f, (seed >> 8) / (float)(1 << 24) * 8.0f - 2.0f);
+		seed = seed * 1664525 + 1013904223;
+		px[i] = (seed >> 8) / (float)(1 << 24) * 2000.0f;
+		seed = seed * 1664525 + 1013904223;
+		py[i] = (seed >> 8) / (float)(1 << 24) * 2000.0f;
+		seed = seed * 1664525 + 1013904223;
+		memcpy(&frame[i], &seed, sizeof(RGB8_t));
+		seed = seed * 1664525 + 1013904223;
+		memcpy(&nextFrame[i], &seed, sizeof(RGB8_t));
+	}
+
+	printf("math benchmark: %d arguments, %d passes\n", MATH_BENCHMARK_SIZE, MATH_BENCHMARK_PASSES);
+	compareKernels("rsqrt", libmRsqrt, fastRsqrtKernel, true, x, x);
+	compareKernels("distance", libmDistance, fastDistanceKernel, true, px, py);
+	compareKernels("log2", libmLog2, fastLog2Kernel, false, x, x);
+	compareKernels("falloff", libmFalloff, fastFalloffKernel, true, x, x);
+	compareBlends("crossfade", floatBlend, rgb8BlendKernel, frame, nextFrame);
+}
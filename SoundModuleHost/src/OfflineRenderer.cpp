@@ -0,0 +1,173 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * OfflineRenderer.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "OfflineRenderer.h"
+#include "SpectrumRebinner.h"
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <vector>
+
+#define MAX_PANELS 256
+
+typedef std::chrono::steady_clock Clock;
+
+/**
+ * rebin the trace's bins as the library rebins the spectrum, truncating the averages to the width of the recording
+ */
+template <typename T>
+static const T* rebinTraceBins(SpectrumRebinner* rebinner, std::vector<float>& wide, const T* in, int nIn,
+		std::vector<T>& out){
+	for (int i = 0; i < nIn; i++){
+		wide[i] = in[i];
+	}
+	rebinner->spectrumRebinnerUpdate(wide.data(), nIn);
+	const float* rebinned = rebinner->getBins(out.size());
+	for (size_t i = 0; i < out.size(); i++){
+		out[i] = (T)rebinned[i];
+	}
+	return out.data();
+}
+
+/**
+ * nearest-rank percentile of sorted samples
+ */
+static double percentile(const std::vector<double>& sorted, double p){
+	size_t rank = (size_t)(p / 100.0 * sorted.size());
+	if (rank >= sorted.size()){
+		rank = sorted.size() - 1;
+	}
+	return sorted[rank];
+}
+
+bool runOffline(PluginLoader* plugin, FeatureTrace* trace, const char* framesPath, long maxFrames, int nPanels,
+		BeatGrid* grid){
+	const EnabledFeatures_t* features = plugin->getEnabledFeatures();
+	bool isSoundPlugin = features->energy || features->fft || features->beatFeatures || features->nBands > 0;
+	long nCalls = (maxFrames > 0) ? maxFrames : trace->getLength();
+
+	FILE* framesFile = NULL;
+	if (framesPath){
+		framesFile = fopen(framesPath, "wb");
+		if (framesFile == NULL){
+			perror("Error: could not open the frames file");
+			return false;
+		}
+	}
+
+	std::vector<Frame_t> frames(nPanels > MAX_PANELS ? nPanels : MAX_PANELS);
+	uint16_t nSourceBins = getSourceFftBins(features);
+	/*traces recorded at the plugin's own linear resolution need no spectrum*/
+	bool isPluginResolution = features->fft && features->fftScale == FFT_SCALE_LINEAR && features->nBands == 0;
+	std::vector<uint8_t> bins(nSourceBins);
+	std::vector<uint16_t> bins16(nSourceBins);
+	int maxBins = (trace->getNFftBins() > nSourceBins) ? trace->getNFftBins() : nSourceBins;
+	std::vector<float> wideBins(maxBins);
+	SpectrumRebinner rebinner;
+	rebinner.spectrumRebinnerInit(maxBins);
+	std::vector<double> latencies;
+	latencies.reserve(nCalls);
+	bool ok = true;
+	double writeSeconds = 0;		/*spent on the frames file, left out of the render throughput*/
+
+	/*each pass over the trace carries on a tick after the end of the one before*/
+	RhythmFeatures_t first, last;
+	BeatFeatures_t unused;
+	trace->getFrame(0, &first, &unused);
+	trace->getFrame(trace->getLength() - 1, &last, &unused);
+	uint64_t passDuration = last.timestamp - first.timestamp + FEATURE_TICK_MS * 1000;
+	uint32_t passSequences = last.sequence - first.sequence + 1;
+
+	plugin->initRhythmFeatures();
+	Clock::time_point begin = Clock::now();
+	for (long i = 0; i < nCalls; i++){
+		RhythmFeatures_t rhythmFeatures;
+		BeatFeatures_t beatFeatures;
+		long pass = i / trace->getLength();
+		trace->getFrame(i % trace->getLength(), &rhythmFeatures, &beatFeatures);
+		rhythmFeatures.timestamp += pass * passDuration;
+		rhythmFeatures.sequence += pass * passSequences;
+		if (nSourceBins > 0 && rhythmFeatures.nFftBins != nSourceBins &&
+				!(isPluginResolution && rhythmFeatures.nFftBins == features->nFftBins)){
+			if (rhythmFeatures.nFftBins == 0){
+				rhythmFeatures.fftBins = bins.data();
+				rhythmFeatures.fftBins16 = NULL;
+			}
+			else if (rhythmFeatures.fftBins16){
+				rhythmFeatures.fftBins16 = rebinTraceBins(&rebinner, wideBins, rhythmFeatures.fftBins16,
+						rhythmFeatures.nFftBins, bins16);
+			}
+			else {
+				rhythmFeatures.fftBins = rebinTraceBins(&rebinner, wideBins, rhythmFeatures.fftBins,
+						rhythmFeatures.nFftBins, bins);
+			}
+			rhythmFeatures.nFftBins = nSourceBins;
+			plugin->updateRhythmFeatures(&rhythmFeatures);
+		}
+		else {
+			/*serve the bins straight from the trace, unless the library has to scale them*/
+			plugin->passRhythmFeatureView(&rhythmFeatures);
+		}
+		plugin->passBeatFeatures(grid ? grid->getBeat(i) : &beatFeatures);
+
+		int nFramesOut = 0;
+		int sleepTime = 1;
+		Clock::time_point start = Clock::now();
+		plugin->getPluginFrame(frames.data(), &nFramesOut, isSoundPlugin ? NULL : &sleepTime);
+		Clock::time_point end = Clock::now();
+		latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+
+		if (framesFile){
+			int32_t n = nFramesOut;
+			bool isWritten = fwrite(&n, sizeof(n), 1, framesFile) == 1 &&
+					fwrite(frames.data(), sizeof(Frame_t), nFramesOut, framesFile) == (size_t)nFramesOut;
+			writeSeconds += std::chrono::duration<double>(Clock::now() - end).count();
+			if (!isWritten){
+				perror("Error: could not write the frames file");
+				ok = false;
+				break;
+			}
+		}
+	}
+	double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+	plugin->deinitRhythmFeatures();
+	if (framesFile){
+		Clock::time_point closing = Clock::now();
+		fclose(framesFile);
+		double closeSeconds = std::chrono::duration<double>(Clock::now() - closing).count();
+		seconds += closeSeconds;
+		writeSeconds += closeSeconds;
+	}
+
+	if (!latencies.empty()){
+		std::sort(latencies.begin(), latencies.end());
+		double renderSeconds = seconds - writeSeconds;
+		printf("offline render: %d frames in %.3f s, %.0f frames/s\n", (int)latencies.size(), renderSeconds,
+				latencies.size() / renderSeconds);
+		if (framesFile){
+			printf("end to end with the frames file: %.3f s, %.0f frames/s\n", seconds, latencies.size() / seconds);
+		}
+		printf("getPluginFrame latency: p50 %.2f us, p99 %.2f us, max %.2f us\n", percentile(latencies, 50),
+				percentile(latencies, 99), latencies.back());
+	}
+	return ok;
+}
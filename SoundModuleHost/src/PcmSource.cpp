@@ -0,0 +1,123 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * PcmSource.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "PcmSource.h"
+#include "SoundFeatureReceiver.h"
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#define MAX_PCM_DATAGRAM 65536
+
+PcmSource::PcmSource(){
+	file = NULL;
+	sock = -1;
+	datagramLength = 0;
+	datagramIndex = 0;
+}
+
+PcmSource::~PcmSource(){
+	close();
+}
+
+bool PcmSource::open(const char* spec){
+	close();
+	if (strcmp(spec, "-") == 0){
+		file = stdin;
+		return true;
+	}
+	if (strncmp(spec, "udp:", 4) != 0){
+		file = fopen(spec, "rb");
+		if (file == NULL){
+			fprintf(stderr, "Error: could not open PCM file %s\n", spec);
+			return false;
+		}
+		return true;
+	}
+
+	sock = socket(AF_INET, SOCK_DGRAM, 0);
+	if (sock < 0){
+		perror("Error: could not create PCM socket");
+		return false;
+	}
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(atoi(spec + 4));
+	inet_pton(AF_INET, SOUND_FEATURE_HOST, &addr.sin_addr);
+	if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0){
+		perror("Error: could not bind PCM socket");
+		close();
+		return false;
+	}
+	datagram.resize(MAX_PCM_DATAGRAM / sizeof(float));
+	return true;
+}
+
+void PcmSource::close(){
+	if (file && file != stdin){
+		fclose(file);
+	}
+	file = NULL;
+	if (sock >= 0){
+		::close(sock);
+		sock = -1;
+	}
+	datagramLength = 0;
+	datagramIndex = 0;
+}
+
+int PcmSource::read(float* samples, int nSamples, int timeoutMs){
+	if (file){
+		size_t n = fread(samples, sizeof(float), nSamples, file);
+		return (n == 0) ? -1 : (int)n;
+	}
+	if (sock < 0){
+		return -1;
+	}
+
+	if (datagramIndex == datagramLength){
+		struct pollfd pfd = {sock, POLLIN, 0};
+		int ready = poll(&pfd, 1, timeoutMs);
+		if (ready <= 0){
+			return (ready == 0 || errno == EINTR) ? 0 : -1;
+		}
+		ssize_t length = recv(sock, datagram.data(), datagram.size() * sizeof(float), 0);
+		if (length < 0){
+			return (errno == EINTR) ? 0 : -1;
+		}
+		datagramLength = length / sizeof(float);
+		datagramIndex = 0;
+	}
+	int n = datagramLength - datagramIndex;
+	if (n > nSamples){
+		n = nSamples;
+	}
+	memcpy(samples, datagram.data() + datagramIndex, n * sizeof(float));
+	datagramIndex += n;
+	return n;
+}
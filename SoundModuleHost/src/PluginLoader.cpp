@@ -0,0 +1,113 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * PluginLoader.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "PluginLoader.h"
+#include <dlfcn.h>
+#include <stdio.h>
+
+#define RESOLVE(member) \
+	if ((*(void**)&member = resolve(#member)) == NULL){ \
+		unload(); \
+		return false; \
+	}
+
+PluginLoader::PluginLoader(){
+	handle = NULL;
+	unload();
+}
+
+PluginLoader::~PluginLoader(){
+	unload();
+}
+
+void* PluginLoader::resolve(const char* symbol){
+	void* address = dlsym(handle, symbol);
+	if (address == NULL){
+		fprintf(stderr, "Error: symbol %s not found: %s\n", symbol, dlerror());
+	}
+	return address;
+}
+
+bool PluginLoader::load(const char* path){
+	unload();
+	handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+	if (handle == NULL){
+		fprintf(stderr, "Error: could not load plugin: %s\n", dlerror());
+		return false;
+	}
+
+	RESOLVE(initPlugin);
+	RESOLVE(getPluginFrame);
+	RESOLVE(pluginCleanup);
+
+	RESOLVE(getPluginUtilitiesVersion);
+	RESOLVE(passLayoutData);
+	RESOLVE(passColorPalette);
+	RESOLVE(dataManagerCleanup);
+	RESOLVE(getEnabledFeatures);
+	RESOLVE(initRhythmFeatures);
+	RESOLVE(updateRhythmFeatures);
+	RESOLVE(deinitRhythmFeatures);
+	RESOLVE(passRhythmFeatureView);
+	RESOLVE(initBeatFeatures);
+	RESOLVE(updateBeatFeatures);
+	RESOLVE(deinitBeatFeatures);
+	RESOLVE(passBeatFeatures);
+	RESOLVE(getBeatFeatures);
+	RESOLVE(initSoundFeatureEngine);
+	RESOLVE(processSoundSamples);
+	RESOLVE(deinitSoundFeatureEngine);
+	RESOLVE(getIsFastOnset);
+	RESOLVE(analyseFeatureBeats);
+	RESOLVE(analysePcmBeats);
+	return true;
+}
+
+void PluginLoader::unload(){
+	if (handle){
+		dlclose(handle);
+		handle = NULL;
+	}
+	initPlugin = NULL;
+	getPluginFrame = NULL;
+	pluginCleanup = NULL;
+	getPluginUtilitiesVersion = NULL;
+	passLayoutData = NULL;
+	passColorPalette = NULL;
+	dataManagerCleanup = NULL;
+	getEnabledFeatures = NULL;
+	initRhythmFeatures = NULL;
+	updateRhythmFeatures = NULL;
+	deinitRhythmFeatures = NULL;
+	passRhythmFeatureView = NULL;
+	initBeatFeatures = NULL;
+	updateBeatFeatures = NULL;
+	deinitBeatFeatures = NULL;
+	passBeatFeatures = NULL;
+	getBeatFeatures = NULL;
+	initSoundFeatureEngine = NULL;
+	processSoundSamples = NULL;
+	deinitSoundFeatureEngine = NULL;
+	getIsFastOnset = NULL;
+	analyseFeatureBeats = NULL;
+	analysePcmBeats = NULL;
+}
@@ -0,0 +1,273 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SelfCheck.cpp
+ *
+ *  Created on: Oct 16, 2026
+ */
+
+#include "SelfCheck.h"
+#include "ColorUtils.h"
+#include "FixedPoint.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#define SELF_CHECK_HUE_MIN -720			/*hues are wrapped, so a few turns either way are checked*/
+#define SELF_CHECK_HUE_MAX 1080
+#define SELF_CHECK_PERCENT_MIN -5		/*saturation and value are clamped to 0 to 100*/
+#define SELF_CHECK_PERCENT_MAX 105
+#define SELF_CHECK_ISQRT_ALL (1 << 22)		/*isqrt is checked on every argument below this*/
+#define SELF_CHECK_SAMPLES 1000000			/*random arguments per fixed point kernel*/
+
+/**
+ * xorshift, so that every run checks the same arguments
+ */
+static uint64_t nextRandom(uint64_t* state){
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	return *state;
+}
+
+static void compare(int64_t actual, int64_t expected, long* maxError){
+	long error = labs((long)(actual - expected));
+	*maxError = (error > *maxError) ? error : *maxError;
+}
+
+/**
+ * @return: whether the kernel is within its documented error
+ */
+static bool report(const char* name, long nCases, long nMismatches, long maxError, long allowedError){
+	bool ok = maxError <= allowedError;
+	printf("%-16s %10ld cases  %8ld differ  max error %ld  %s\n", name, nCases, nMismatches, maxError, ok ? "ok" : "FAILED");
+	return ok;
+}
+
+/**
+ * every colour, one red level at a time
+ */
+static bool checkRGBtoHSVBatch(void){
+	const int n = 256 * 256;
+	std::vector<uint8_t> rgb(3 * n);
+	std::vector<int> h(n), s(n), v(n);
+	long nMismatches = 0;
+	long maxError = 0;
+	for (int r = 0; r < 256; r++){
+		for (int i = 0; i < n; i++){
+			rgb[3 * i] = r;
+			rgb[3 * i + 1] = i >> 8;
+			rgb[3 * i + 2] = i & 0xff;
+		}
+		RGBtoHSVBatch(rgb.data(), h.data(), s.data(), v.data(), n);
+		for (int i = 0; i < n; i++){
+			RGB_t color = {rgb[3 * i], rgb[3 * i + 1], rgb[3 * i + 2]};
+			HSV_t expected;
+			RGBtoHSV(color, &expected);
+			if (h[i] != expected.H || s[i] != expected.S || v[i] != expected.V){
+				nMismatches++;
+			}
+			compare(h[i], expected.H, &maxError);
+			compare(s[i], expected.S, &maxError);
+			compare(v[i], expected.V, &maxError);
+		}
+	}
+	return report("RGBtoHSVBatch", 256L * n, nMismatches, maxError, 0);
+}
+
+/**
+ * every saturation and value around 0 to 100, for hues over several turns and at the ends of the int range
+ */
+static bool checkHSVtoRGBBatch(void){
+	std::vector<int> hues;
+	for (int hue = SELF_CHECK_HUE_MIN; hue < SELF_CHECK_HUE_MAX; hue++){
+		hues.push_back(hue);
+	}
+	hues.push_back(INT32_MAX);
+	hues.push_back(INT32_MIN);
+	hues.push_back(INT32_MIN + 1);
+
+	const int nPercents = SELF_CHECK_PERCENT_MAX - SELF_CHECK_PERCENT_MIN + 1;
+	const int n = nPercents * nPercents;
+	std::vector<int> h(n), s(n), v(n);
+	std::vector<uint8_t> rgb(3 * n);
+	long nMismatches = 0;
+	long maxError = 0;
+	for (size_t k = 0; k < hues.size(); k++){
+		for (int i = 0; i < n; i++){
+			h[i] = hues[k];
+			s[i] = SELF_CHECK_PERCENT_MIN + i / nPercents;
+			v[i] = SELF_CHECK_PERCENT_MIN + i % nPercents;
+		}
+		HSVtoRGBBatch(h.data(), s.data(), v.data(), rgb.data(), n);
+		for (int i = 0; i < n; i++){
+			HSV_t color = {h[i], s[i], v[i]};
+			RGB_t expected;
+			HSVtoRGB(color, &expected);
+			if (rgb[3 * i] != expected.R || rgb[3 * i + 1] != expected.G || rgb[3 * i + 2] != expected.B){
+				nMismatches++;
+			}
+			compare(rgb[3 * i], expected.R, &maxError);
+			compare(rgb[3 * i + 1], expected.G, &maxError);
+			compare(rgb[3 * i + 2], expected.B, &maxError);
+		}
+	}
+	return report("HSVtoRGBBatch", (long)hues.size() * n, nMismatches, maxError, 0);
+}
+
+/**
+ * every small argument, then arguments of every magnitude and the squares either side of which the root changes
+ */
+static bool checkIsqrt(void){
+	long nMismatches = 0;
+	long maxError = 0;
+	for (uint64_t x = 0; x < SELF_CHECK_ISQRT_ALL; x++){
+		uint32_t actual = isqrtFixed(x);
+		uint32_t expected = isqrtFloat(x);
+		nMismatches += actual != expected;
+		compare(actual, expected, &maxError);
+	}
+	uint64_t state = 1;
+	for (int i = 0; i < SELF_CHECK_SAMPLES; i++){
+		uint64_t x = nextRandom(&state) >> (nextRandom(&state) % 64);
+		uint64_t root = nextRandom(&state) >> 33;
+		uint64_t arguments[3] = {x, root * root, root * root - 1};
+		for (int j = 0; j < 3; j++){
+			uint32_t actual = isqrtFixed(arguments[j]);
+			uint32_t expected = isqrtFloat(arguments[j]);
+			nMismatches += actual != expected;
+			compare(actual, expected, &maxError);
+		}
+	}
+	return report("isqrt", SELF_CHECK_ISQRT_ALL + 3L * SELF_CHECK_SAMPLES, nMismatches, maxError, 0);
+}
+
+/**
+ * coordinates within 8192 of the origin, so that they differ by less than the documented 32768
+ */
+static bool checkDistanceQ16(void){
+	long nMismatches = 0;
+	long maxError = 0;
+	uint64_t state = 2;
+	for (int i = 0; i < SELF_CHECK_SAMPLES; i++){
+		q16_t c[4];
+		for (int j = 0; j < 4; j++){
+			c[j] = (q16_t)(nextRandom(&state) % (1u << 30)) - (1 << 29);
+		}
+		q16_t actual = distanceQ16Fixed(c[0], c[1], c[2], c[3]);
+		q16_t expected = distanceQ16Float(c[0], c[1], c[2], c[3]);
+		nMismatches += actual != expected;
+		compare(actual, expected, &maxError);
+	}
+	return report("distanceQ16", SELF_CHECK_SAMPLES, nMismatches, maxError, 0);
+}
+
+/**
+ * distances and factors of every magnitude, and those of the examples' falloffs
+ */
+static bool checkFalloffQ15(void){
+	long nMismatches = 0;
+	long maxError = 0;
+	uint64_t state = 3;
+	for (int i = 0; i < SELF_CHECK_SAMPLES; i++){
+		q16_t d = nextRandom(&state) % (1u << 31);
+		q16_t k = nextRandom(&state) % (1u << (nextRandom(&state) % 32));
+		if (i % 2){
+			d = nextRandom(&state) % (1u << 24);
+			k = nextRandom(&state) % (1u << 12);
+		}
+		q15_t actual = falloffQ15Fixed(d, k);
+		q15_t expected = falloffQ15Float(d, k);
+		nMismatches += actual != expected;
+		compare(actual, expected, &maxError);
+	}
+	return report("falloffQ15", SELF_CHECK_SAMPLES, nMismatches, maxError, 0);
+}
+
+static bool checkBlendQ15(void){
+	long nMismatches = 0;
+	long maxError = 0;
+	uint64_t state = 4;
+	for (int i = 0; i < SELF_CHECK_SAMPLES; i++){
+		int a = nextRandom(&state) % 256;
+		int b = nextRandom(&state) % 256;
+		q15_t t = nextRandom(&state) % (Q15_ONE + 1);
+		int actual = blendQ15Fixed(a, b, t);
+		int expected = blendQ15Float(a, b, t);
+		nMismatches += actual != expected;
+		compare(actual, expected, &maxError);
+	}
+	return report("blendQ15", SELF_CHECK_SAMPLES, nMismatches, maxError, 0);
+}
+
+/**
+ * positions from a colour before the palette to one after it
+ */
+static bool checkPaletteRGBQ16(void){
+	const RGB_t palette[3] = {{255, 0, 10}, {0, 255, 20}, {3, 7, 250}};
+	long nMismatches = 0;
+	long maxError = 0;
+	uint64_t state = 5;
+	for (int i = 0; i < SELF_CHECK_SAMPLES; i++){
+		q16_t position = (q16_t)(nextRandom(&state) % (4u * Q16_ONE)) - Q16_ONE;
+		RGB_t actual = getPaletteRGBQ16Fixed(palette, 3, position);
+		RGB_t expected = getPaletteRGBQ16Float(palette, 3, position);
+		nMismatches += actual.R != expected.R || actual.G != expected.G || actual.B != expected.B;
+		compare(actual.R, expected.R, &maxError);
+		compare(actual.G, expected.G, &maxError);
+		compare(actual.B, expected.B, &maxError);
+	}
+	return report("getPaletteRGBQ16", SELF_CHECK_SAMPLES, nMismatches, maxError, 0);
+}
+
+/**
+ * arguments of every magnitude, as bins and their running maxima are; the small ones include powers of a common
+ * base, whose ratios land exactly on a step
+ */
+static bool checkLogarithms(void){
+	long nMismatches[2] = {0, 0};
+	long maxError[2] = {0, 0};
+	uint64_t state = 6;
+	for (int i = 0; i < SELF_CHECK_SAMPLES; i++){
+		uint32_t x = nextRandom(&state) >> (32 + nextRandom(&state) % 32);
+		uint32_t max = nextRandom(&state) >> (32 + nextRandom(&state) % 32);
+		x = x ? x : 1;
+		q16_t log2Actual = log2Q16Fixed(x);
+		q16_t log2Expected = log2Q16Float(x);
+		nMismatches[0] += log2Actual != log2Expected;
+		compare(log2Actual, log2Expected, &maxError[0]);
+		q15_t ratioActual = logRatioQ15Fixed(x, max);
+		q15_t ratioExpected = logRatioQ15Float(x, max);
+		nMismatches[1] += ratioActual != ratioExpected;
+		compare(ratioActual, ratioExpected, &maxError[1]);
+	}
+	bool ok = report("log2Q16", SELF_CHECK_SAMPLES, nMismatches[0], maxError[0], 0);
+	return report("logRatioQ15", SELF_CHECK_SAMPLES, nMismatches[1], maxError[1], 0) && ok;
+}
+
+bool runSelfCheck(void){
+	printf("self check: kernels against their references\n");
+	bool ok = checkRGBtoHSVBatch();
+	ok = checkHSVtoRGBBatch() && ok;
+	ok = checkIsqrt() && ok;
+	ok = checkDistanceQ16() && ok;
+	ok = checkFalloffQ15() && ok;
+	ok = checkBlendQ15() && ok;
+	ok = checkPaletteRGBQ16() && ok;
+	ok = checkLogarithms() && ok;
+	return ok;
+}
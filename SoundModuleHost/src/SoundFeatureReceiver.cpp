@@ -0,0 +1,155 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SoundFeatureReceiver.cpp
+ *
+ *  Created on: Oct 15, 2026
+ */
+
+#include "SoundFeatureReceiver.h"
+#include <arpa/inet.h>
+#include <chrono>
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+SoundFeatureReceiver::SoundFeatureReceiver(){
+	sock = -1;
+	nFftBins = 0;
+	sequence = 0;
+	hasBeatFeatures = false;
+}
+
+SoundFeatureReceiver::~SoundFeatureReceiver(){
+	close();
+}
+
+bool SoundFeatureReceiver::open(uint16_t port){
+	close();
+	sock = socket(AF_INET, SOCK_DGRAM, 0);
+	if (sock < 0){
+		perror("Error: could not create feature socket");
+		return false;
+	}
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(port);
+	inet_pton(AF_INET, SOUND_FEATURE_HOST, &addr.sin_addr);
+	if (bind(sock, (struct sockaddr*)&addr, sizeof(addr)) < 0){
+		perror("Error: could not bind feature socket");
+		close();
+		return false;
+	}
+	return true;
+}
+
+void SoundFeatureReceiver::close(){
+	if (sock >= 0){
+		::close(sock);
+		sock = -1;
+	}
+}
+
+bool SoundFeatureReceiver::requestFeatures(const EnabledFeatures_t* enabledFeatures){
+	nFftBins = getSourceFftBins(enabledFeatures);
+
+	char request[32];
+	int length = snprintf(request, sizeof(request), "%d %d %d %d %d", nFftBins > 0 ? 1 : 0, nFftBins,
+			enabledFeatures->energy ? 1 : 0, SOUND_FEATURE_BIN_BYTES, SOUND_FEATURE_VERSION);
+
+	struct sockaddr_in addr;
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_port = htons(SOUND_FEATURE_REQUEST_PORT);
+	inet_pton(AF_INET, SOUND_FEATURE_HOST, &addr.sin_addr);
+	if (sendto(sock, request, length, 0, (struct sockaddr*)&addr, sizeof(addr)) != length){
+		perror("Error: could not send feature request");
+		return false;
+	}
+	return true;
+}
+
+int SoundFeatureReceiver::receive(RhythmFeatures_t* rhythmFeatures, int timeoutMs){
+	struct pollfd pfd = {sock, POLLIN, 0};
+	int ready = poll(&pfd, 1, timeoutMs);
+	if (ready <= 0){
+		return (ready == 0 || errno == EINTR) ? 0 : -1;
+	}
+
+	ssize_t length = recv(sock, packet, sizeof(packet), 0);
+	if (length < 0){
+		return (errno == EINTR) ? 0 : -1;
+	}
+	hasBeatFeatures = false;
+	const SoundFeaturePacket_t* header = (const SoundFeaturePacket_t*)packet;
+	if (length >= (ssize_t)sizeof(SoundFeaturePacket_t) && header->magic == SOUND_FEATURE_MAGIC){
+		return receiveVersion2(length, rhythmFeatures);
+	}
+	if (length < nFftBins + (ssize_t)sizeof(uint16_t)){
+		fprintf(stderr, "Warning: dropping short feature packet (%d bytes)\n", (int)length);
+		return 0;
+	}
+
+	/*older versions of music_processor.py ignore the trailing request fields and send the raw bins*/
+	rhythmFeatures->timestamp = std::chrono::duration_cast<std::chrono::microseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count();
+	rhythmFeatures->sequence = sequence++;
+	rhythmFeatures->nFftBins = nFftBins;
+	rhythmFeatures->fftBins = packet;
+	rhythmFeatures->fftBins16 = NULL;
+	memcpy(&rhythmFeatures->energy, packet + nFftBins, sizeof(uint16_t));
+	return 1;
+}
+
+/**
+ * the bins are served from the packet itself. The header is no shorter than SoundFeaturePacket_t and even,
+ * so the bins are aligned for uint16
+ */
+int SoundFeatureReceiver::receiveVersion2(ssize_t length, RhythmFeatures_t* rhythmFeatures){
+	const SoundFeaturePacket_t* header = (const SoundFeaturePacket_t*)packet;
+	if (header->version < SOUND_FEATURE_VERSION || header->headerSize < sizeof(SoundFeaturePacket_t) ||
+			header->headerSize % 2 != 0 || (header->binBytes != 1 && header->binBytes != 2) ||
+			header->nFftBins > MAX_FFT_BINS || length < header->headerSize + header->nFftBins * header->binBytes){
+		fprintf(stderr, "Warning: dropping malformed feature packet (%d bytes)\n", (int)length);
+		return 0;
+	}
+	const uint8_t* bins = packet + header->headerSize;
+	rhythmFeatures->energy = (header->flags & SOUND_FEATURE_HAS_ENERGY) ? header->energy : 0;
+	rhythmFeatures->timestamp = header->timestamp;
+	rhythmFeatures->sequence = header->sequence;
+	rhythmFeatures->nFftBins = (header->flags & SOUND_FEATURE_HAS_FFT) ? header->nFftBins : 0;
+	rhythmFeatures->fftBins = (header->binBytes == 1) ? bins : NULL;
+	rhythmFeatures->fftBins16 = (header->binBytes == 2) ? (const uint16_t*)bins : NULL;
+
+	hasBeatFeatures = (header->flags & SOUND_FEATURE_HAS_BEAT) != 0;
+	if (hasBeatFeatures){
+		beatFeatures.isBeat = (header->beatFlags & SOUND_FEATURE_IS_BEAT) != 0;
+		beatFeatures.isOnset = (header->beatFlags & SOUND_FEATURE_IS_ONSET) != 0;
+		beatFeatures.tempo = header->tempo;
+		beatFeatures.confidence = header->confidence / 255.0f;
+	}
+	return 1;
+}
+
+const BeatFeatures_t* SoundFeatureReceiver::getBeatFeatures(){
+	return hasBeatFeatures ? &beatFeatures : NULL;
+}
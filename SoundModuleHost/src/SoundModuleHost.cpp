@@ -0,0 +1,569 @@
+/*
+    Copyright 2017 Nanoleaf Ltd.
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+ */
+
+/*
+ * SoundModuleHost.cpp
+ *
+ *  Created on: Oct 15, 2026
+ *
+ *  Linux replacement for the SoundModuleSimulator: loads a plugin, feeds it the sound features
+ *  streamed by music_processor.py, or computed in process from PCM, and sends its frames to an Aurora.
+ *  With -t it instead renders a recorded feature trace headless, as fast as the plugin allows.
+ *  With -b it only analyses the beats of a whole trace or PCM file and writes them to a beat grid.
+ *  With -m it only benchmarks the fast math helpers against libm.
+ *  With -s it only checks the library's batch and fixed point kernels against their references.
+ */
+
+#include "AuroraStream.h"
+#include "BeatGrid.h"
+#include "FeatureTrace.h"
+#include "HostData.h"
+#include "MathBenchmark.h"
+#include "OfflineRenderer.h"
+#include "PcmSource.h"
+#include "SelfCheck.h"
+#include "PluginLoader.h"
+#include "SoundFeatureReceiver.h"
+#include <chrono>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#define AUTH_TOKEN_FILE "auth_tokens"
+#define SLEEP_TIME_UNIT_MS 100			/*effects plugins give their sleepTime in multiples of 100ms, like transTime*/
+#define FEATURE_TIMEOUT_MS 1000
+#define FAST_ONSET_RECEIVED 2			/*the feature engine found an onset before its update completed*/
+#define MAX_PANELS 256
+#define DEFAULT_SAMPLE_RATE 44100
+
+typedef std::chrono::steady_clock Clock;
+
+struct HostOptions {
+	const char* pluginPath;
+	const char* ip;
+	const char* palettePath;
+	const char* layoutPath;
+	const char* tracePath;		/*render this trace offline instead of running live*/
+	const char* framesPath;		/*offline mode: write the rendered frames here*/
+	const char* recordPath;		/*live mode: record the received features here*/
+	const char* pcmSource;		/*live mode: compute the features from this PCM instead of music_processor.py*/
+	const char* beatGridPath;	/*analyse the beats of the trace or the PCM into this beat grid instead of running the plugin*/
+	const char* playGridPath;	/*serve the beat features from this beat grid instead of the beat engine*/
+	int nThreads;				/*for the beat analysis, 0 for every core*/
+	int sampleRate;
+	long maxFrames;				/*stop after this many frames, 0 to run until interrupted*/
+	bool verbose;
+	bool mathBenchmark;			/*benchmark FastMath.h against libm instead of running a plugin*/
+	bool selfCheck;				/*check the library's kernels against their references instead of running a plugin*/
+};
+
+static volatile sig_atomic_t running = 1;
+
+static void onSignal(int){
+	running = 0;
+}
+
+static void printUsage(const char* name){
+	printf("usage: %s -p <plugin .so> [-i <aurora ip>] [-cp <palette file>] [-l <layout file>] [-a <pcm source> [-sr <rate>]] [-r <trace>] [-g <beat grid>] [-n <frames>] [-v]\n"
+			"       %s -p <plugin .so> -l <layout file> -t <trace> [-cp <palette file>] [-o <frames file>] [-g <beat grid>] [-n <frames>]\n"
+			"       %s -p <plugin .so> -b <beat grid> (-t <trace> | -a <pcm file> [-sr <rate>]) [-j <threads>]\n"
+			"       %s -m\n"
+			"       %s -s\n"
+			"  -p   absolute path to the libAuroraPlugin.so to run\n"
+			"  -i   ip address of the Aurora to display on; its layout is used unless -l is given\n"
+			"  -cp  palette file written by the plugin builder tool\n"
+			"  -l   layout JSON as returned by the Aurora's panelLayout/layout endpoint\n"
+			"  -a   compute the sound features from mono float32 PCM: a file, - for stdin or udp:<port>\n"
+			"  -sr  sample rate of the PCM, default %d\n"
+			"  -r   record the received sound features, and the beat features served to the plugin, to a binary trace\n"
+			"  -n   stop after this many frames\n"
+			"  -v   print every frame\n"
+			"  -t   render this feature trace offline and report frames/s and getPluginFrame latency\n"
+			"  -o   offline mode: write every call's frames here as an int32 count and that many Frame_t\n"
+			"  -b   analyse the beats of a whole trace or PCM file in parallel and write them to a beat grid\n"
+			"  -j   number of threads for -b, default every core\n"
+			"  -g   serve the beat features from a beat grid written by -b, aligned to the start of the sound, instead of detecting them\n"
+			"  -m   benchmark the fast math helpers of the utilities library against libm\n"
+			"  -s   check the batch colour conversions and fixed point kernels of the utilities library against their references\n",
+			name, name, name, name, name, DEFAULT_SAMPLE_RATE);
+}
+
+static bool parseArguments(int argc, char** argv, HostOptions* options){
+	memset(options, 0, sizeof(*options));
+	options->sampleRate = DEFAULT_SAMPLE_RATE;
+	for (int i = 1; i < argc; i++){
+		const char* arg = argv[i];
+		const char* value = (i + 1 < argc) ? argv[i + 1] : NULL;
+		if (strcmp(arg, "-v") == 0){
+			options->verbose = true;
+			continue;
+		}
+		if (strcmp(arg, "-m") == 0){
+			options->mathBenchmark = true;
+			continue;
+		}
+		if (strcmp(arg, "-s") == 0){
+			options->selfCheck = true;
+			continue;
+		}
+		if (value == NULL){
+			fprintf(stderr, "Error: %s needs a value\n", arg);
+			return false;
+		}
+		if (strcmp(arg, "-p") == 0){
+			options->pluginPath = value;
+		}
+		else if (strcmp(arg, "-i") == 0){
+			options->ip = value;
+		}
+		else if (strcmp(arg, "-cp") == 0){
+			options->palettePath = value;
+		}
+		else if (strcmp(arg, "-l") == 0){
+			options->layoutPath = value;
+		}
+		else if (strcmp(arg, "-t") == 0){
+			options->tracePath = value;
+		}
+		else if (strcmp(arg, "-a") == 0){
+			options->pcmSource = value;
+		}
+		else if (strcmp(arg, "-sr") == 0){
+			options->sampleRate = atoi(value);
+		}
+		else if (strcmp(arg, "-r") == 0){
+			options->recordPath = value;
+		}
+		else if (strcmp(arg, "-o") == 0){
+			options->framesPath = value;
+		}
+		else if (strcmp(arg, "-n") == 0){
+			options->maxFrames = atol(value);
+		}
+		else if (strcmp(arg, "-b") == 0){
+			options->beatGridPath = value;
+		}
+		else if (strcmp(arg, "-g") == 0){
+			options->playGridPath = value;
+		}
+		else if (strcmp(arg, "-j") == 0){
+			options->nThreads = atoi(value);
+		}
+		else {
+			fprintf(stderr, "Error: unknown option %s\n", arg);
+			return false;
+		}
+		i++;
+	}
+	if (options->mathBenchmark || options->selfCheck){
+		if (argc != 2){
+			fprintf(stderr, "Error: %s takes no other options\n", options->mathBenchmark ? "-m" : "-s");
+			return false;
+		}
+		return true;
+	}
+	if (options->pluginPath == NULL){
+		fprintf(stderr, "Error: no plugin given\n");
+		return false;
+	}
+	if (options->beatGridPath){
+		if ((options->tracePath == NULL) == (options->pcmSource == NULL)){
+			fprintf(stderr, "Error: -b analyses either a trace or a PCM file\n");
+			return false;
+		}
+		if (options->playGridPath){
+			fprintf(stderr, "Error: -g is not used with -b\n");
+			return false;
+		}
+		if (options->pcmSource && strncmp(options->pcmSource, "udp:", 4) == 0){
+			fprintf(stderr, "Error: -b needs the whole PCM, from a file or stdin\n");
+			return false;
+		}
+		if (options->sampleRate <= 0){
+			fprintf(stderr, "Error: invalid sample rate\n");
+			return false;
+		}
+		return true;
+	}
+	if (options->tracePath && (options->layoutPath == NULL || options->ip)){
+		fprintf(stderr, "Error: offline mode needs a layout file and no Aurora\n");
+		return false;
+	}
+	if ((options->recordPath || options->pcmSource) && options->tracePath){
+		fprintf(stderr, "Error: -r and -a are only used in live mode\n");
+		return false;
+	}
+	if (options->sampleRate <= 0){
+		fprintf(stderr, "Error: invalid sample rate\n");
+		return false;
+	}
+	if (options->framesPath && options->tracePath == NULL){
+		fprintf(stderr, "Error: -o is only used in offline mode\n");
+		return false;
+	}
+	if (options->layoutPath == NULL && options->ip == NULL){
+		fprintf(stderr, "Error: either a layout file or an Aurora is needed\n");
+		return false;
+	}
+	return true;
+}
+
+static void printFrames(const Frame_t* frames, int nFrames){
+	for (int i = 0; i < nFrames; i++){
+		printf("%d:(%d,%d,%d)/%d ", frames[i].panelId, frames[i].r, frames[i].g, frames[i].b, frames[i].transTime);
+	}
+	printf("\n");
+}
+
+/**
+ * hand layout and palette over to the plugin's utilities library and initialize the plugin
+ */
+static bool setUpPlugin(PluginLoader* plugin, const HostOptions* options, AuroraStream* aurora, int* nPanels){
+	std::vector<int> layoutStream;
+	if (options->layoutPath){
+		if (!readLayoutFile(options->layoutPath, &layoutStream, nPanels)){
+			return false;
+		}
+	}
+	else {
+		std::string json;
+		if (!aurora->get("panelLayout", &json) || !parseLayout(json, &layoutStream, nPanels)){
+			fprintf(stderr, "Error: could not get the layout from the Aurora\n");
+			return false;
+		}
+	}
+
+	std::vector<int> paletteStream;
+	int nColors = 0;
+	if (options->palettePath && !readPaletteFile(options->palettePath, &paletteStream, &nColors)){
+		return false;
+	}
+
+	plugin->passLayoutData(layoutStream.data(), *nPanels);
+	plugin->passColorPalette(paletteStream.data(), nColors);
+	plugin->initPlugin();
+	return true;
+}
+
+static void printFrameStats(long nFrames, double totalUs, double maxUs){
+	if (nFrames == 0){
+		return;
+	}
+	printf("%ld frames, getPluginFrame mean %.1f us, max %.1f us\n", nFrames, totalUs / nFrames, maxUs);
+}
+
+/**
+ * latency from the capture of the sound features to their frame being sent, and gaps in the feature sequence
+ */
+struct FeatureStats {
+	long nUpdates;
+	double totalLatencyUs;
+	double maxLatencyUs;
+	uint32_t nextSequence;
+	long nDropped;
+	long nReordered;
+};
+
+static void updateFeatureStats(FeatureStats* stats, const RhythmFeatures_t* rhythmFeatures, Clock::time_point sent){
+	double latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(sent.time_since_epoch()).count() -
+			(double)rhythmFeatures->timestamp;
+	stats->totalLatencyUs += latencyUs;
+	if (latencyUs > stats->maxLatencyUs){
+		stats->maxLatencyUs = latencyUs;
+	}
+
+	int32_t gap = (int32_t)(rhythmFeatures->sequence - stats->nextSequence);
+	if (stats->nUpdates > 0 && gap < 0){
+		stats->nReordered++;
+	}
+	else {
+		if (stats->nUpdates > 0){
+			stats->nDropped += gap;
+		}
+		stats->nextSequence = rhythmFeatures->sequence + 1;
+	}
+	stats->nUpdates++;
+}
+
+static void printFeatureStats(const FeatureStats* stats){
+	if (stats->nUpdates == 0){
+		return;
+	}
+	printf("%ld feature updates, capture to frame latency mean %.1f ms, max %.1f ms, %ld dropped, %ld out of order\n",
+			stats->nUpdates, stats->totalLatencyUs / stats->nUpdates / 1000, stats->maxLatencyUs / 1000,
+			stats->nDropped, stats->nReordered);
+}
+
+/**
+ * feed PCM to the utilities library's feature engine until it completes an update, or finds an onset
+ * on its fast path
+ * @params samples: read buffer, its samples [*begin, *end) not yet consumed
+ * @return: as SoundFeatureReceiver::receive, or FAST_ONSET_RECEIVED, which leaves rhythmFeatures unset
+ */
+static int receivePcmFeatures(PluginLoader* plugin, PcmSource* pcm, std::vector<float>* samples, int* begin, int* end,
+		RhythmFeatures_t* rhythmFeatures){
+	while (true){
+		if (*begin == *end){
+			int n = pcm->read(samples->data(), samples->size(), FEATURE_TIMEOUT_MS);
+			if (n <= 0){
+				return n;
+			}
+			*begin = 0;
+			*end = n;
+		}
+		bool isUpdated = false;
+		*begin += plugin->processSoundSamples(samples->data() + *begin, *end - *begin, &isUpdated, rhythmFeatures);
+		if (isUpdated){
+			return 1;
+		}
+		if (plugin->getIsFastOnset()){
+			return FAST_ONSET_RECEIVED;
+		}
+	}
+}
+
+/**
+ * position in the beat grid of the features just received. PCM is counted in feature updates, so that
+ * the grid stays aligned to the samples; updates from music_processor.py are placed by their capture time,
+ * relative to the first, which keeps them aligned across dropped packets
+ */
+static long getPlaybackTick(const RhythmFeatures_t* rhythmFeatures, bool isPcm, uint64_t* start){
+	if (isPcm){
+		return rhythmFeatures->sequence;
+	}
+	if (*start == 0){
+		*start = rhythmFeatures->timestamp;
+	}
+	int64_t us = (int64_t)(rhythmFeatures->timestamp - *start);
+	if (us < 0){
+		return -1;
+	}
+	return (us + FEATURE_TICK_MS * 500) / (FEATURE_TICK_MS * 1000);
+}
+
+/**
+ * Sound plugins are called once per feature update, but no sooner than FEATURE_TICK_MS after the previous call.
+ * With a PCM source they are also called as soon as the fast path of the feature engine finds an onset.
+ * Effects plugins are called after the sleepTime they ask for.
+ * With a beat grid, the beat engine is not run and the grid's beat features are served instead.
+ */
+static void runLive(PluginLoader* plugin, const HostOptions* options, AuroraStream* aurora, int nPanels, BeatGrid* grid){
+	const EnabledFeatures_t* features = plugin->getEnabledFeatures();
+	bool isSoundPlugin = features->energy || features->fft || features->beatFeatures || features->nBands > 0;
+
+	SoundFeatureReceiver receiver;
+	PcmSource pcm;
+	std::vector<float> samples;
+	int samplesBegin = 0;
+	int samplesEnd = 0;
+	FeatureTraceWriter recorder;
+	if (isSoundPlugin){
+		if (options->pcmSource){
+			if (!pcm.open(options->pcmSource)){
+				return;
+			}
+			samples.resize(plugin->initSoundFeatureEngine(options->sampleRate));
+		}
+		else if (!receiver.open(SOUND_FEATURE_PORT) || !receiver.requestFeatures(features)){
+			return;
+		}
+		if (options->recordPath && !recorder.open(options->recordPath, getSourceFftBins(features), sizeof(uint16_t))){
+			return;
+		}
+		plugin->initRhythmFeatures();
+		if (features->beatFeatures && grid == NULL){
+			plugin->initBeatFeatures();
+		}
+		if (options->pcmSource == NULL){
+			printf("Sound plugin: waiting for music_processor.py\n");
+		}
+	}
+
+	std::vector<Frame_t> frames(nPanels > MAX_PANELS ? nPanels : MAX_PANELS);
+	Clock::time_point nextFrame = Clock::now();
+	long nFrames = 0;
+	double totalUs = 0;
+	double maxUs = 0;
+	FeatureStats featureStats;
+	memset(&featureStats, 0, sizeof(featureStats));
+	uint64_t playbackStart = 0;
+
+	while (running && (options->maxFrames == 0 || nFrames < options->maxFrames)){
+		RhythmFeatures_t rhythmFeatures;
+		bool isFastFrame = false;
+		if (isSoundPlugin){
+			int received;
+			if (options->pcmSource){
+				received = receivePcmFeatures(plugin, &pcm, &samples, &samplesBegin, &samplesEnd, &rhythmFeatures);
+			}
+			else {
+				received = receiver.receive(&rhythmFeatures, FEATURE_TIMEOUT_MS);
+			}
+			if (received < 0){
+				break;
+			}
+			if (received == 0){
+				continue;
+			}
+			isFastFrame = received == FAST_ONSET_RECEIVED;
+		}
+		if (isSoundPlugin && !isFastFrame){
+			if (options->pcmSource == NULL){
+				plugin->updateRhythmFeatures(&rhythmFeatures);
+			}
+			/*a source that tracks beats itself sends them along with the features*/
+			const BeatFeatures_t* sourceBeats = options->pcmSource ? NULL : receiver.getBeatFeatures();
+			if (grid){
+				plugin->passBeatFeatures(grid->getBeat(getPlaybackTick(&rhythmFeatures, options->pcmSource != NULL, &playbackStart)));
+			}
+			else if (features->beatFeatures && sourceBeats){
+				plugin->passBeatFeatures(sourceBeats);
+			}
+			else if (features->beatFeatures){
+				plugin->updateBeatFeatures();
+			}
+			if (options->recordPath && !recorder.write(&rhythmFeatures, plugin->getBeatFeatures())){
+				break;
+			}
+		}
+		/*an onset is rendered at once, in between the frames of the updates*/
+		if (!isFastFrame){
+			std::this_thread::sleep_until(nextFrame);
+		}
+
+		int nFramesOut = 0;
+		int sleepTime = 1;
+		Clock::time_point start = Clock::now();
+		plugin->getPluginFrame(frames.data(), &nFramesOut, isSoundPlugin ? NULL : &sleepTime);
+		Clock::time_point end = Clock::now();
+
+		double us = std::chrono::duration<double, std::micro>(end - start).count();
+		totalUs += us;
+		if (us > maxUs){
+			maxUs = us;
+		}
+		nFrames++;
+
+		if (isSoundPlugin){
+			if (!isFastFrame){
+				nextFrame = start + std::chrono::milliseconds(FEATURE_TICK_MS);
+			}
+		}
+		else {
+			nextFrame = start + std::chrono::milliseconds(SLEEP_TIME_UNIT_MS * (sleepTime > 0 ? sleepTime : 1));
+		}
+		if (options->verbose){
+			printFrames(frames.data(), nFramesOut);
+		}
+		aurora->sendFrames(frames.data(), nFramesOut);
+		if (isSoundPlugin && !isFastFrame){
+			updateFeatureStats(&featureStats, &rhythmFeatures, Clock::now());
+		}
+	}
+	printFrameStats(nFrames, totalUs, maxUs);
+	printFeatureStats(&featureStats);
+
+	if (isSoundPlugin){
+		if (features->beatFeatures){
+			plugin->deinitBeatFeatures();
+		}
+		if (options->pcmSource){
+			plugin->deinitSoundFeatureEngine();
+		}
+		plugin->deinitRhythmFeatures();
+	}
+}
+
+int main(int argc, char** argv){
+	HostOptions options;
+	if (!parseArguments(argc, argv, &options)){
+		printUsage(argv[0]);
+		return 1;
+	}
+	if (options.mathBenchmark){
+		runMathBenchmark();
+		return 0;
+	}
+	if (options.selfCheck){
+		return runSelfCheck() ? 0 : 1;
+	}
+
+	FeatureTrace trace;
+	if (options.tracePath && !trace.load(options.tracePath)){
+		return 1;
+	}
+	BeatGrid grid;
+	if (options.playGridPath && !grid.load(options.playGridPath)){
+		return 1;
+	}
+
+	AuroraStream aurora;
+	if (options.ip){
+		std::string authToken;
+		if (!readAuthToken(AUTH_TOKEN_FILE, &authToken)){
+			fprintf(stderr, "Error: no auth token, pair with the Aurora using the plugin builder tool first\n");
+			return 1;
+		}
+		aurora.setAurora(options.ip, authToken.c_str());
+	}
+
+	PluginLoader plugin;
+	if (!plugin.load(options.pluginPath)){
+		return 1;
+	}
+	printf("Loaded plugin %s, utilities library %s\n", options.pluginPath, plugin.getPluginUtilitiesVersion());
+	if (options.beatGridPath){
+		/*initialized with no panels, so that PCM is analysed on the bins the plugin enables*/
+		int noData = 0;
+		plugin.passLayoutData(&noData, 0);
+		plugin.passColorPalette(&noData, 0);
+		plugin.initPlugin();
+		bool ok = analyseBeatGrid(&plugin, options.tracePath ? &trace : NULL, options.pcmSource, options.sampleRate,
+				options.beatGridPath, options.nThreads);
+		plugin.pluginCleanup();
+		plugin.dataManagerCleanup();
+		return ok ? 0 : 1;
+	}
+
+	int nPanels = 0;
+	if (!setUpPlugin(&plugin, &options, &aurora, &nPanels)){
+		return 1;
+	}
+	if (options.ip && !aurora.open()){
+		plugin.pluginCleanup();
+		plugin.dataManagerCleanup();
+		return 1;
+	}
+
+	int status = 0;
+	if (options.tracePath){
+		if (!runOffline(&plugin, &trace, options.framesPath, options.maxFrames, nPanels, options.playGridPath ? &grid : NULL)){
+			status = 1;
+		}
+	}
+	else {
+		signal(SIGINT, onSignal);
+		signal(SIGTERM, onSignal);
+		runLive(&plugin, &options, &aurora, nPanels, options.playGridPath ? &grid : NULL);
+	}
+
+	plugin.pluginCleanup();
+	plugin.dataManagerCleanup();
+	return status;
+}
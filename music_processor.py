@@ -17,21 +17,48 @@ import librosa
 import numpy as np
 import argparse
 import socket
+import struct
 import sys
 import threading
+import time as time_module
 from time import sleep, time
 from distutils.version import StrictVersion
 
 
+SOUND_FEATURE_MAGIC = 0x46534c4e     # reads "NLSF" from memory on a little endian host
+SOUND_FEATURE_HEADER_FORMAT = '=IBBBBHHIQfBBH'
+SOUND_FEATURE_HAS_ENERGY = 0x01
+SOUND_FEATURE_HAS_FFT = 0x02
+
 pyaudio_lock = threading.Lock()
 keypress_lock = threading.Lock()
 stop_pyaudio_thread = False
 data_buffer = []
 data_buffer_updated = False
+data_buffer_timestamp = 0
 sample_rate = 0
 stop_loop = False
 
 
+def monotonic_us():
+    '''
+    :return:    microseconds of CLOCK_MONOTONIC, the clock the plugin host reads as well
+    '''
+    try:
+        return int(time_module.monotonic() * 1e6)
+    except AttributeError:
+        # python 2 has no time.monotonic
+        import ctypes
+        import ctypes.util
+
+        class timespec(ctypes.Structure):
+            _fields_ = [('tv_sec', ctypes.c_long), ('tv_nsec', ctypes.c_long)]
+        librt = ctypes.CDLL(ctypes.util.find_library('rt') or ctypes.util.find_library('c'), use_errno=True)
+        ts = timespec()
+        librt.clock_gettime(1, ctypes.byref(ts))   # CLOCK_MONOTONIC
+        return ts.tv_sec * 1000000 + ts.tv_nsec // 1000
+
+
 class KeyPressThread (threading.Thread):
     def __init__(self):
         threading.Thread.__init__(self)
@@ -100,10 +127,12 @@ class PyAudioThread (threading.Thread):
 
     @staticmethod
     def input_callback(in_data, frame_count, time_info, status):
-        global data_buffer, data_buffer_updated
+        global data_buffer, data_buffer_updated, data_buffer_timestamp
+        timestamp = monotonic_us()
         pyaudio_lock.acquire()
         data_buffer = in_data       # fill data
         data_buffer_updated = True  # set updated flag
+        data_buffer_timestamp = timestamp
         pyaudio_lock.release()
         return None, pyaudio.paContinue
 
@@ -179,7 +208,7 @@ def check_min_versions():
     return ret
 
 
-def get_output_fft_bins(fft_mag, n_out):
+def get_output_fft_bins(fft_mag, n_out, max_value):
     n_in = len(fft_mag)
     step_size = int(n_in/n_out)
     fft_out = np.zeros(n_out)
@@ -189,15 +218,15 @@ def get_output_fft_bins(fft_mag, n_out):
         acc = np.sum(fft_mag[i:min(i+step_size, n_in)])
         acc /= step_size
         i += step_size
-        # saturate to 8-bit unsigned
-        if acc > 255:
-            acc = 255
+        # saturate to the output width
+        if acc > max_value:
+            acc = max_value
         fft_out[n_filled] = acc
         n_filled += 1
     return fft_out[0:n_out]
 
 
-def process_music_data(data_in, is_fft, is_energy, n_output_bins, n_fft, is_visual):
+def process_music_data(data_in, is_fft, is_energy, n_output_bins, n_fft, is_visual, bin_bytes):
     # length is len(data_in)/4
     data_np = np.fromstring(data_in, 'Float32')
 
@@ -233,10 +262,14 @@ def process_music_data(data_in, is_fft, is_energy, n_output_bins, n_fft, is_visu
 
         # magnitude scaling
         fft_data_mag *= 2**3
-        fft_output = get_output_fft_bins(fft_data_mag, n_output_bins)
-        fft_output = fft_output.astype(np.uint8)
+        if bin_bytes == 2:
+            fft_output = get_output_fft_bins(fft_data_mag, n_output_bins, 2**16 - 1)
+            fft_output = fft_output.astype(np.uint16)
+        else:
+            fft_output = get_output_fft_bins(fft_data_mag, n_output_bins, 2**8 - 1)
+            fft_output = fft_output.astype(np.uint8)
     else:
-        fft_output = np.zeros(n_output_bins).astype(np.uint8)
+        fft_output = np.zeros(n_output_bins).astype(np.uint16 if bin_bytes == 2 else np.uint8)
 
     return fft_output, energy_output
 
@@ -278,13 +311,22 @@ if __name__ == '__main__':
     udp_socket.close()
     print "Plugin detected... continuing"
 
-    # packet contains: [b i b] where b is boolean, i is integer
+    # packet contains: [b i b [i [i]]] where b is boolean, i is integer. The optional fields are the bin width
+    # in bytes and the version of the feature packets: 1 for the raw uint8 bins and energy, 2 for the packets
+    # described below, the only ones with wide bins
     if from_host == udp_host:
         tokens = packet.split()
 
     is_fft = int(tokens[0])
     n_bins_out = int(tokens[1])
     is_energy = int(tokens[2])
+    bin_bytes = int(tokens[3]) if len(tokens) > 3 else 1
+    version = int(tokens[4]) if len(tokens) > 4 else 1
+    if version >= 2:
+        version = 2
+    if bin_bytes != 2 or version == 1:
+        bin_bytes = 1
+    sequence = 0
     # print "Sound features requested: fft {} fft bins {} energy {}".format(is_fft, n_bins_out, is_energy)
 
     # start pyaudio thread
@@ -317,6 +359,7 @@ if __name__ == '__main__':
         pyaudio_lock.acquire()
         data_updated = data_buffer_updated
         data = data_buffer
+        data_timestamp = data_buffer_timestamp
         data_buffer_updated = False
         pyaudio_lock.release()
 
@@ -327,7 +370,8 @@ if __name__ == '__main__':
                                                is_energy,
                                                n_bins_out,
                                                n_fft,
-                                               visualize)
+                                               visualize,
+                                               bin_bytes)
 
             stopTime = time()
             elapsedTime = (stopTime - startTime) * 1000
@@ -338,6 +382,17 @@ if __name__ == '__main__':
 
             # message to simulator
             message = fft.tobytes() + energy.tobytes()
+            if version == 2:
+                # native byte order, see SoundFeaturePacket_t in SoundModuleHost/inc/SoundFeatureReceiver.h:
+                # magic, version, header size, flags, bin width, bin count, energy, sequence number,
+                # capture time in us, then the beat fields, tempo, beat flags, confidence and padding, which this
+                # script leaves unset. The bins follow the header
+                flags = (SOUND_FEATURE_HAS_ENERGY if is_energy else 0) | (SOUND_FEATURE_HAS_FFT if is_fft else 0)
+                header = struct.pack(SOUND_FEATURE_HEADER_FORMAT, SOUND_FEATURE_MAGIC, 2,
+                                     struct.calcsize(SOUND_FEATURE_HEADER_FORMAT), flags, bin_bytes, len(fft),
+                                     int(energy) if is_energy else 0, sequence, data_timestamp, 0.0, 0, 0, 0)
+                message = header + fft.tobytes()
+                sequence = (sequence + 1) & 0xffffffff
             # print "fft {} energy {}".format(fft, energy)
             
             udp_socket.sendto(message, (udp_host, udp_port))
@@ -1,5 +1,6 @@
 from printer import *
 import os
+import sys
 import time
 import glob
 import threading
@@ -79,10 +80,14 @@ class SoundModuleSimulatorWrapper:
 			break
 		lib_path = lib_path + lib_name
 		os.chdir(upper_dir)
-		if self.palette_entered:
-			command = ["./SoundModuleSimulator", "-i", str(self.ip_addr), "-p", lib_path, "-cp", self.palette_path, "1>$2"]
+		if "linux" in sys.platform:
+			command = ["./SoundModuleHost/Debug/SoundModuleHost", "-i", str(self.ip_addr), "-p", lib_path]
 		else:
-			command = ["./SoundModuleSimulator", "-i", str(self.ip_addr), "-p", lib_path, "1>$2"]
+			command = ["./SoundModuleSimulator", "-i", str(self.ip_addr), "-p", lib_path]
+		if self.palette_entered:
+			command += ["-cp", self.palette_path]
+		if not "linux" in sys.platform:
+			command += ["1>$2"]
 		iprint(command)
 		try:
 			self.sms_proc = subprocess.Popen(command, cwd=upper_dir, stderr=subprocess.PIPE, stdin=subprocess.PIPE)
@@ -90,7 +95,7 @@ class SoundModuleSimulatorWrapper:
 		except OSError, oserr:
 			if (str(oserr.errno) == "2"):
 				iprint("Error: " + str(oserr.errno))
-				iprint("Please make sure you have SoundModuleSimulator")
+				iprint("Please make sure you have SoundModuleSimulator, or on Linux have built SoundModuleHost")
 			else:
 				iprint(oserr)
 			return